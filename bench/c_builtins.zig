@@ -0,0 +1,49 @@
+//! Compares the string and memory builtins of `lib/c_builtins.zig` with libc.
+const std = @import("std");
+const c_builtins = @import("c_builtins");
+const common = @import("common.zig");
+
+const libc = struct {
+    extern "c" fn strlen(s: [*c]const u8) usize;
+    extern "c" fn strcmp(s1: [*c]const u8, s2: [*c]const u8) c_int;
+    extern "c" fn memchr(ptr: ?*const anyopaque, val: c_int, len: usize) ?*anyopaque;
+    extern "c" fn memcpy(noalias dst: ?*anyopaque, noalias src: ?*const anyopaque, len: usize) ?*anyopaque;
+    extern "c" fn memcmp(ptr1: ?*const anyopaque, ptr2: ?*const anyopaque, len: usize) c_int;
+    extern "c" fn memmove(dst: ?*anyopaque, src: ?*const anyopaque, len: usize) ?*anyopaque;
+    extern "c" fn memset(dst: ?*anyopaque, val: c_int, len: usize) ?*anyopaque;
+};
+
+const lengths = [_]usize{ 7, 64, 1000, 65536 };
+
+pub fn main() !void {
+    const gpa = std.heap.page_allocator;
+    common.printHeader("c_builtins", "libc");
+
+    for (lengths) |len| {
+        // Start the strings at an odd offset to include the unaligned prologue.
+        const a_buf = try gpa.alloc(u8, len + 2);
+        defer gpa.free(a_buf);
+        const b_buf = try gpa.alloc(u8, len + 2);
+        defer gpa.free(b_buf);
+        const a = a_buf[1..][0 .. len + 1];
+        const b = b_buf[1..][0 .. len + 1];
+        @memset(a[0..len], 'a');
+        @memset(b[0..len], 'a');
+        a[len] = 0;
+        b[len] = 0;
+
+        try run("strlen", len, c_builtins.strlen, libc.strlen, .{a.ptr});
+        try run("strcmp", len, c_builtins.strcmp, libc.strcmp, .{ a.ptr, b.ptr });
+        try run("memchr", len, c_builtins.memchr, libc.memchr, .{ a.ptr, @as(c_int, 0), len + 1 });
+        try run("memcmp", len, c_builtins.memcmp, libc.memcmp, .{ a.ptr, b.ptr, len });
+        try run("memcpy", len, c_builtins.memcpy, libc.memcpy, .{ b.ptr, a.ptr, len });
+        try run("memmove", len, c_builtins.memmove, libc.memmove, .{ a_buf.ptr, a.ptr, len });
+        try run("memset", len, c_builtins.memset, libc.memset, .{ b.ptr, @as(c_int, 'a'), len });
+    }
+}
+
+fn run(comptime name: []const u8, len: usize, comptime func: anytype, comptime baseline: anytype, args: anytype) !void {
+    var buf: [32]u8 = undefined;
+    const label = try std.fmt.bufPrint(&buf, "{s}/{d}", .{ name, len });
+    common.report(label, try common.measure(func, args), try common.measure(baseline, args));
+}
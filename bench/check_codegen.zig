@@ -0,0 +1,83 @@
+//! Checks the assembly emitted for `codegen.zig` and reports the number of
+//! instructions of each helper next to its builtin baseline. Fails if a helper
+//! calls into `helpers`, `c_builtins` or a panic handler, which means that it
+//! stopped being inlined or gained runtime safety checks, or if it is more than
+//! `slack` instructions longer than its baseline.
+//!
+//! Usage: check-codegen <codegen.s>
+const std = @import("std");
+const mem = std.mem;
+const helper_ops = @import("helper_ops.zig");
+
+/// Instructions a helper may take over its baseline, which absorbs differences in
+/// register allocation or instruction selection that do not indicate a regression.
+const slack = 2;
+
+pub fn main() !void {
+    var arena_instance = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_instance.deinit();
+    const arena = arena_instance.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len != 2) {
+        std.debug.print("usage: {s} <codegen.s>\n", .{args[0]});
+        return error.InvalidArguments;
+    }
+    const source = try std.fs.cwd().readFileAlloc(args[1], arena, .unlimited);
+
+    var failed = false;
+    std.debug.print("{s:<32} {s:>8} {s:>8}\n", .{ "function", "helper", "builtin" });
+    inline for (helper_ops.ops) |op| {
+        const name = helper_ops.name(op);
+        const helper = try function(source, "helper_" ++ name);
+        const baseline = try function(source, "baseline_" ++ name);
+        std.debug.print("{s:<32} {d:>8} {d:>8}\n", .{ name, helper.instructions, baseline.instructions });
+        if (helper.bad_call) |call| {
+            std.debug.print("  helper_{s} calls '{s}'\n", .{ name, call });
+            failed = true;
+        }
+        if (helper.instructions > baseline.instructions + slack) {
+            std.debug.print("  helper_{s} is longer than its baseline\n", .{name});
+            failed = true;
+        }
+    }
+    if (failed) return error.HelperRegressed;
+}
+
+const Function = struct {
+    instructions: usize,
+    /// An instruction referring to a helper or a panic handler.
+    bad_call: ?[]const u8,
+};
+
+/// Scans the body of the function labelled `name` in `source`. Mach-O symbols
+/// are prefixed with an underscore.
+fn function(source: []const u8, name: []const u8) !Function {
+    var lines = mem.splitScalar(u8, source, '\n');
+    while (lines.next()) |line| {
+        const label = mem.trimEnd(u8, line, ":");
+        if (label.len + 1 != line.len) continue;
+        if (mem.eql(u8, label, name)) break;
+        if (label.len == name.len + 1 and label[0] == '_' and mem.eql(u8, label[1..], name)) break;
+    } else {
+        std.debug.print("function {s} not found\n", .{name});
+        return error.FunctionNotFound;
+    }
+
+    var result: Function = .{ .instructions = 0, .bad_call = null };
+    while (lines.next()) |line| {
+        // The body ends at the next global label or at the end of function marker.
+        if (line.len > 0 and !std.ascii.isWhitespace(line[0])) {
+            // Local labels start with `.L` in ELF and COFF and with `L` in Mach-O.
+            if (mem.startsWith(u8, line, ".Lfunc_end") or !(mem.startsWith(u8, line, ".L") or line[0] == 'L')) break;
+            continue;
+        }
+        const inst = mem.trim(u8, line, " \t");
+        if (inst.len == 0 or inst[0] == '.' or inst[0] == '#' or inst[0] == ';' or mem.startsWith(u8, inst, "//")) continue;
+        result.instructions += 1;
+        for ([_][]const u8{ "helpers.", "c_builtins.", "panic" }) |needle| {
+            if (mem.indexOf(u8, inst, needle) != null) result.bad_call = result.bad_call orelse inst;
+        }
+    }
+    return result;
+}
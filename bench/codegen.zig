@@ -0,0 +1,10 @@
+//! Exports both versions of every operation in `helper_ops.zig` so that their
+//! machine code can be compared by `check_codegen.zig`.
+const helper_ops = @import("helper_ops.zig");
+
+comptime {
+    for (helper_ops.ops) |op| {
+        @export(&op.helper, .{ .name = "helper_" ++ helper_ops.name(op) });
+        @export(&op.baseline, .{ .name = "baseline_" ++ helper_ops.name(op) });
+    }
+}
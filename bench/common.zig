@@ -0,0 +1,36 @@
+//! Measurement and reporting shared by the benchmarks.
+const std = @import("std");
+
+/// Minimum time spent measuring a single benchmark.
+pub const min_ns = 100 * std.time.ns_per_ms;
+
+/// Number of calls between reads of the timer.
+const batch_size = 64;
+
+/// Calls `func` with `args` repeatedly for at least `min_ns` and returns
+/// the mean time of one call in nanoseconds.
+pub fn measure(comptime func: anytype, args: anytype) !f64 {
+    var call_args = args;
+    var timer = try std.time.Timer.start();
+    var calls: u64 = 0;
+    var elapsed: u64 = 0;
+    while (elapsed < min_ns) {
+        for (0..batch_size) |_| {
+            // Prevent the call from being hoisted out of the loop.
+            std.mem.doNotOptimizeAway(&call_args);
+            std.mem.doNotOptimizeAway(@call(.auto, func, call_args));
+        }
+        calls += batch_size;
+        elapsed = timer.read();
+    }
+    return @as(f64, @floatFromInt(elapsed)) / @as(f64, @floatFromInt(calls));
+}
+
+pub fn printHeader(name: []const u8, baseline_name: []const u8) void {
+    std.debug.print("{s:<32} {s:>13} {s:>13} {s:>8}\n", .{ "benchmark", name, baseline_name, "speedup" });
+}
+
+/// Prints one result comparing `ns` with the time of the baseline implementation.
+pub fn report(name: []const u8, ns: f64, baseline_ns: f64) void {
+    std.debug.print("{s:<32} {d:>10.1} ns {d:>10.1} ns {d:>7.2}x\n", .{ name, ns, baseline_ns, baseline_ns / ns });
+}
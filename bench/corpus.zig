@@ -0,0 +1,110 @@
+//! Generates a self-contained C header for benchmarking translate-c.
+//!
+//! Usage: bench-corpus <thousands of decls> <output.h>
+//!
+//! The header repeats a group of declarations in roughly the proportions found
+//! in large library and SDK headers: mostly structs and macros, with enums,
+//! typedefs, prototypes and static inline functions referring to them. The
+//! output only depends on the requested size.
+const std = @import("std");
+
+/// Number of declarations emitted by `writeGroup`.
+const decls_per_group = 20;
+
+pub fn main() !void {
+    var arena_instance = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_instance.deinit();
+    const arena = arena_instance.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len != 3) {
+        std.debug.print("usage: {s} <thousands of decls> <output.h>\n", .{args[0]});
+        return error.InvalidArguments;
+    }
+    const thousands = try std.fmt.parseInt(usize, args[1], 10);
+    const groups = thousands * 1000 / decls_per_group;
+
+    const file = try std.fs.cwd().createFile(args[2], .{});
+    defer file.close();
+    var buf: [4096]u8 = undefined;
+    var file_writer = file.writer(&buf);
+    const w = &file_writer.interface;
+
+    try w.writeAll(
+        \\#ifndef BENCH_SYNTHETIC_H
+        \\#define BENCH_SYNTHETIC_H
+        \\
+        \\typedef unsigned long bench_size_t;
+        \\typedef unsigned char bench_u8;
+        \\typedef unsigned int bench_u32;
+        \\typedef unsigned long long bench_u64;
+        \\
+        \\
+    );
+    for (0..groups) |i| try writeGroup(w, i);
+    try w.writeAll("#endif\n");
+    try w.flush();
+}
+
+fn writeGroup(w: *std.Io.Writer, i: usize) !void {
+    // 5 structs; the last one also declares an enum, a union and a function pointer.
+    try w.print(
+        \\struct point_{0d} {{ int x, y; }};
+        \\struct rect_{0d} {{ struct point_{0d} min, max; }};
+        \\struct buffer_{0d} {{ bench_u8 *data; bench_size_t len, cap; }};
+        \\struct node_{0d} {{ struct node_{0d} *next, *prev; void *payload; }};
+        \\struct handler_{0d} {{
+        \\    enum kind_{0d} {{ KIND_{0d}_NONE, KIND_{0d}_INT, KIND_{0d}_FLOAT = 4 }} kind;
+        \\    union {{ bench_u64 u; double f; char bytes[8]; }} value;
+        \\    int (*callback)(struct handler_{0d} *self, void *user);
+        \\}};
+        \\
+    , .{i});
+    // A second enum whose values refer to each other.
+    try w.print(
+        \\enum flags_{0d} {{
+        \\    FLAG_{0d}_READ = 1 << 0,
+        \\    FLAG_{0d}_WRITE = 1 << 1,
+        \\    FLAG_{0d}_ALL = FLAG_{0d}_READ | FLAG_{0d}_WRITE,
+        \\}};
+        \\
+    , .{i});
+    // 2 typedefs.
+    try w.print(
+        \\typedef struct rect_{0d} rect_{0d}_t;
+        \\typedef int (*compare_{0d}_fn)(const void *a, const void *b);
+        \\
+    , .{i});
+    // 2 prototypes.
+    try w.print(
+        \\int buffer_{0d}_reserve(struct buffer_{0d} *buf, bench_size_t cap);
+        \\void node_{0d}_sort(struct node_{0d} *head, compare_{0d}_fn compare);
+        \\
+    , .{i});
+    // 3 static inline functions.
+    try w.print(
+        \\static inline int rect_{0d}_area(const rect_{0d}_t *r) {{
+        \\    return (r->max.x - r->min.x) * (r->max.y - r->min.y);
+        \\}}
+        \\static inline int rect_{0d}_contains(const rect_{0d}_t *r, struct point_{0d} p) {{
+        \\    return p.x >= r->min.x && p.x < r->max.x && p.y >= r->min.y && p.y < r->max.y;
+        \\}}
+        \\static inline bench_u32 hash_{0d}(const bench_u8 *data, bench_size_t len) {{
+        \\    bench_u32 h = 2166136261u;
+        \\    for (bench_size_t j = 0; j < len; j++) h = (h ^ data[j]) * 16777619u;
+        \\    return h;
+        \\}}
+        \\
+    , .{i});
+    // 6 macros: constants, casts and function-like macros.
+    try w.print(
+        \\#define VERSION_{0d} ((1u << 22) | ({0d}u << 12) | 3u)
+        \\#define MAX_ITEMS_{0d} 0x{0x}UL
+        \\#define DEFAULT_SCALE_{0d} 1.5f
+        \\#define NAME_{0d} "synthetic_{0d}"
+        \\#define MIN_{0d}(a, b) ((a) < (b) ? (a) : (b))
+        \\#define BUFFER_{0d}_END(buf) ((buf)->data + (buf)->len)
+        \\
+        \\
+    , .{i});
+}
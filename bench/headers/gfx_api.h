@@ -0,0 +1,172 @@
+/*
+ * A self-contained header in the style of a large graphics SDK: opaque handles
+ * declared through macros, versioned create-info structs chained through
+ * `next` pointers, enums sized to 32 bits, flag bitmasks and a table of
+ * function pointers. It has no includes so it translates the same on any host.
+ */
+#ifndef GFX_API_H
+#define GFX_API_H
+
+#define GFX_MAKE_VERSION(major, minor, patch) \
+    ((((unsigned)(major)) << 22) | (((unsigned)(minor)) << 12) | ((unsigned)(patch)))
+#define GFX_VERSION_MAJOR(version) ((unsigned)(version) >> 22)
+#define GFX_VERSION_MINOR(version) (((unsigned)(version) >> 12) & 0x3FFU)
+#define GFX_VERSION_PATCH(version) ((unsigned)(version) & 0xFFFU)
+#define GFX_API_VERSION_1_0 GFX_MAKE_VERSION(1, 0, 0)
+#define GFX_API_VERSION_1_1 GFX_MAKE_VERSION(1, 1, 0)
+
+#define GFX_NULL_HANDLE 0
+#define GFX_DEFINE_HANDLE(object) typedef struct object##_T *object;
+
+#define GFX_TRUE 1U
+#define GFX_FALSE 0U
+#define GFX_WHOLE_SIZE (~0ULL)
+#define GFX_MAX_NAME_SIZE 256U
+#define GFX_LOD_CLAMP_NONE 1000.0F
+
+typedef unsigned int GfxBool32;
+typedef unsigned int GfxFlags;
+typedef unsigned long long GfxDeviceSize;
+typedef unsigned long long GfxDeviceAddress;
+
+GFX_DEFINE_HANDLE(GfxInstance)
+GFX_DEFINE_HANDLE(GfxDevice)
+GFX_DEFINE_HANDLE(GfxQueue)
+GFX_DEFINE_HANDLE(GfxCommandBuffer)
+GFX_DEFINE_HANDLE(GfxBuffer)
+GFX_DEFINE_HANDLE(GfxImage)
+
+typedef enum GfxResult {
+    GFX_SUCCESS = 0,
+    GFX_NOT_READY = 1,
+    GFX_TIMEOUT = 2,
+    GFX_ERROR_OUT_OF_HOST_MEMORY = -1,
+    GFX_ERROR_OUT_OF_DEVICE_MEMORY = -2,
+    GFX_ERROR_DEVICE_LOST = -4,
+    GFX_RESULT_MAX_ENUM = 0x7FFFFFFF
+} GfxResult;
+
+typedef enum GfxStructureType {
+    GFX_STRUCTURE_TYPE_APPLICATION_INFO = 0,
+    GFX_STRUCTURE_TYPE_INSTANCE_CREATE_INFO = 1,
+    GFX_STRUCTURE_TYPE_DEVICE_CREATE_INFO = 3,
+    GFX_STRUCTURE_TYPE_BUFFER_CREATE_INFO = 12,
+    GFX_STRUCTURE_TYPE_IMAGE_CREATE_INFO = 14,
+    GFX_STRUCTURE_TYPE_MAX_ENUM = 0x7FFFFFFF
+} GfxStructureType;
+
+typedef enum GfxFormat {
+    GFX_FORMAT_UNDEFINED = 0,
+    GFX_FORMAT_R8G8B8A8_UNORM = 37,
+    GFX_FORMAT_B8G8R8A8_SRGB = 50,
+    GFX_FORMAT_R32G32B32A32_SFLOAT = 109,
+    GFX_FORMAT_D32_SFLOAT = 126,
+    GFX_FORMAT_MAX_ENUM = 0x7FFFFFFF
+} GfxFormat;
+
+typedef enum GfxBufferUsageFlagBits {
+    GFX_BUFFER_USAGE_TRANSFER_SRC_BIT = 0x00000001,
+    GFX_BUFFER_USAGE_TRANSFER_DST_BIT = 0x00000002,
+    GFX_BUFFER_USAGE_UNIFORM_BUFFER_BIT = 0x00000010,
+    GFX_BUFFER_USAGE_STORAGE_BUFFER_BIT = 0x00000020,
+    GFX_BUFFER_USAGE_INDEX_BUFFER_BIT = 0x00000040,
+    GFX_BUFFER_USAGE_VERTEX_BUFFER_BIT = 0x00000080,
+    GFX_BUFFER_USAGE_FLAG_BITS_MAX_ENUM = 0x7FFFFFFF
+} GfxBufferUsageFlagBits;
+typedef GfxFlags GfxBufferUsageFlags;
+
+typedef struct GfxApplicationInfo {
+    GfxStructureType type;
+    const void *next;
+    const char *application_name;
+    unsigned application_version;
+    const char *engine_name;
+    unsigned engine_version;
+    unsigned api_version;
+} GfxApplicationInfo;
+
+typedef struct GfxInstanceCreateInfo {
+    GfxStructureType type;
+    const void *next;
+    GfxFlags flags;
+    const GfxApplicationInfo *application_info;
+    unsigned enabled_layer_count;
+    const char *const *enabled_layer_names;
+    unsigned enabled_extension_count;
+    const char *const *enabled_extension_names;
+} GfxInstanceCreateInfo;
+
+typedef struct GfxExtent3D {
+    unsigned width;
+    unsigned height;
+    unsigned depth;
+} GfxExtent3D;
+
+typedef struct GfxBufferCreateInfo {
+    GfxStructureType type;
+    const void *next;
+    GfxFlags flags;
+    GfxDeviceSize size;
+    GfxBufferUsageFlags usage;
+    unsigned queue_family_index_count;
+    const unsigned *queue_family_indices;
+} GfxBufferCreateInfo;
+
+typedef struct GfxImageCreateInfo {
+    GfxStructureType type;
+    const void *next;
+    GfxFlags flags;
+    GfxFormat format;
+    GfxExtent3D extent;
+    unsigned mip_levels;
+    unsigned array_layers;
+} GfxImageCreateInfo;
+
+typedef struct GfxAllocationCallbacks {
+    void *user_data;
+    void *(*allocate)(void *user_data, unsigned long size, unsigned long alignment, int scope);
+    void *(*reallocate)(void *user_data, void *original, unsigned long size, unsigned long alignment, int scope);
+    void (*free)(void *user_data, void *memory);
+} GfxAllocationCallbacks;
+
+typedef union GfxClearColorValue {
+    float float32[4];
+    int int32[4];
+    unsigned uint32[4];
+} GfxClearColorValue;
+
+typedef void (*PFN_gfxVoidFunction)(void);
+typedef GfxResult (*PFN_gfxCreateInstance)(const GfxInstanceCreateInfo *create_info, const GfxAllocationCallbacks *allocator, GfxInstance *instance);
+typedef void (*PFN_gfxDestroyInstance)(GfxInstance instance, const GfxAllocationCallbacks *allocator);
+typedef PFN_gfxVoidFunction (*PFN_gfxGetInstanceProcAddr)(GfxInstance instance, const char *name);
+typedef GfxResult (*PFN_gfxCreateBuffer)(GfxDevice device, const GfxBufferCreateInfo *create_info, const GfxAllocationCallbacks *allocator, GfxBuffer *buffer);
+typedef GfxResult (*PFN_gfxCreateImage)(GfxDevice device, const GfxImageCreateInfo *create_info, const GfxAllocationCallbacks *allocator, GfxImage *image);
+typedef void (*PFN_gfxCmdCopyBuffer)(GfxCommandBuffer command_buffer, GfxBuffer src, GfxBuffer dst, GfxDeviceSize size);
+
+typedef struct GfxDeviceDispatch {
+    PFN_gfxCreateBuffer create_buffer;
+    PFN_gfxCreateImage create_image;
+    PFN_gfxCmdCopyBuffer cmd_copy_buffer;
+} GfxDeviceDispatch;
+
+GfxResult gfxCreateInstance(const GfxInstanceCreateInfo *create_info, const GfxAllocationCallbacks *allocator, GfxInstance *instance);
+void gfxDestroyInstance(GfxInstance instance, const GfxAllocationCallbacks *allocator);
+PFN_gfxVoidFunction gfxGetInstanceProcAddr(GfxInstance instance, const char *name);
+GfxResult gfxCreateBuffer(GfxDevice device, const GfxBufferCreateInfo *create_info, const GfxAllocationCallbacks *allocator, GfxBuffer *buffer);
+GfxResult gfxCreateImage(GfxDevice device, const GfxImageCreateInfo *create_info, const GfxAllocationCallbacks *allocator, GfxImage *image);
+void gfxCmdCopyBuffer(GfxCommandBuffer command_buffer, GfxBuffer src, GfxBuffer dst, GfxDeviceSize size);
+
+static inline GfxDeviceSize gfxAlignUp(GfxDeviceSize value, GfxDeviceSize alignment) {
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+static inline GfxBool32 gfxFormatIsDepth(GfxFormat format) {
+    switch (format) {
+    case GFX_FORMAT_D32_SFLOAT:
+        return GFX_TRUE;
+    default:
+        return GFX_FALSE;
+    }
+}
+
+#endif
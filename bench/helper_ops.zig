@@ -0,0 +1,154 @@
+//! Operations for which translated code calls a helper from `lib/helpers.zig`
+//! or `lib/c_builtins.zig`, each paired with the builtin expression that a
+//! hand-written Zig program would use instead. Both versions of an operation
+//! take two `c_int`s, use the C calling convention and are expected to compile
+//! to the same code in ReleaseFast.
+const std = @import("std");
+const helpers = @import("helpers");
+const c_builtins = @import("c_builtins");
+
+pub const ops = [_]type{
+    cast_int_to_long,
+    cast_int_to_uint,
+    cast_int_to_u8,
+    cast_int_to_double,
+    cast_int_to_ptr,
+    signed_remainder,
+    div_int_uint,
+    rem_long_int,
+    flexible_array,
+    popcount,
+    clz,
+    abs,
+};
+
+const cast_int_to_long = struct {
+    pub fn helper(x: c_int, _: c_int) callconv(.c) c_long {
+        return helpers.cast(c_long, x);
+    }
+    pub fn baseline(x: c_int, _: c_int) callconv(.c) c_long {
+        return x;
+    }
+};
+
+const cast_int_to_uint = struct {
+    pub fn helper(x: c_int, _: c_int) callconv(.c) c_uint {
+        return helpers.cast(c_uint, x);
+    }
+    pub fn baseline(x: c_int, _: c_int) callconv(.c) c_uint {
+        return @bitCast(x);
+    }
+};
+
+const cast_int_to_u8 = struct {
+    pub fn helper(x: c_int, _: c_int) callconv(.c) u8 {
+        return helpers.cast(u8, x);
+    }
+    pub fn baseline(x: c_int, _: c_int) callconv(.c) u8 {
+        return @bitCast(@as(i8, @truncate(x)));
+    }
+};
+
+const cast_int_to_double = struct {
+    pub fn helper(x: c_int, _: c_int) callconv(.c) f64 {
+        return helpers.cast(f64, x);
+    }
+    pub fn baseline(x: c_int, _: c_int) callconv(.c) f64 {
+        return @floatFromInt(x);
+    }
+};
+
+const cast_int_to_ptr = struct {
+    pub fn helper(x: c_int, _: c_int) callconv(.c) usize {
+        return @intFromPtr(helpers.cast(?*anyopaque, x));
+    }
+    pub fn baseline(x: c_int, _: c_int) callconv(.c) usize {
+        return @bitCast(@as(isize, x));
+    }
+};
+
+const signed_remainder = struct {
+    pub fn helper(x: c_int, y: c_int) callconv(.c) c_int {
+        return helpers.signedRemainder(x, y);
+    }
+    pub fn baseline(x: c_int, y: c_int) callconv(.c) c_int {
+        return @rem(x, y);
+    }
+};
+
+const div_int_uint = struct {
+    pub fn helper(x: c_int, y: c_int) callconv(.c) c_uint {
+        return helpers.div(x, @as(c_uint, @bitCast(y)));
+    }
+    pub fn baseline(x: c_int, y: c_int) callconv(.c) c_uint {
+        return @as(c_uint, @bitCast(x)) / @as(c_uint, @bitCast(y));
+    }
+};
+
+const rem_long_int = struct {
+    pub fn helper(x: c_int, y: c_int) callconv(.c) c_long {
+        return helpers.rem(@as(c_long, x), y);
+    }
+    pub fn baseline(x: c_int, y: c_int) callconv(.c) c_long {
+        return @rem(@as(c_long, x), y);
+    }
+};
+
+/// A struct with a flexible array member, declared the way translate-c declares it.
+const Packet = extern struct {
+    len: c_int,
+    _items: [0]c_int,
+    pub fn items(self: anytype) helpers.FlexibleArrayType(@TypeOf(self), @typeInfo(@TypeOf(self.*._items)).array.child) {
+        return @ptrCast(@alignCast(&self.*._items));
+    }
+};
+
+var packet: extern struct {
+    header: Packet,
+    items: [8]c_int,
+} = .{
+    .header = .{ .len = 8, ._items = .{} },
+    .items = .{ 1, 2, 3, 4, 5, 6, 7, 8 },
+};
+
+const flexible_array = struct {
+    pub fn helper(x: c_int, y: c_int) callconv(.c) c_int {
+        return (&packet.header).items()[@as(c_uint, @bitCast(y)) & 7] +% x;
+    }
+    pub fn baseline(x: c_int, y: c_int) callconv(.c) c_int {
+        return packet.items[@as(c_uint, @bitCast(y)) & 7] +% x;
+    }
+};
+
+const popcount = struct {
+    pub fn helper(x: c_int, _: c_int) callconv(.c) c_int {
+        return c_builtins.popcount(@bitCast(x));
+    }
+    pub fn baseline(x: c_int, _: c_int) callconv(.c) c_int {
+        return @popCount(x);
+    }
+};
+
+const clz = struct {
+    pub fn helper(x: c_int, _: c_int) callconv(.c) c_int {
+        return c_builtins.clz(@as(c_uint, @bitCast(x)) | 1);
+    }
+    pub fn baseline(x: c_int, _: c_int) callconv(.c) c_int {
+        return @clz(@as(c_uint, @bitCast(x)) | 1);
+    }
+};
+
+const abs = struct {
+    pub fn helper(x: c_int, _: c_int) callconv(.c) c_int {
+        return c_builtins.abs(x);
+    }
+    pub fn baseline(x: c_int, _: c_int) callconv(.c) c_int {
+        return @bitCast(@abs(x));
+    }
+};
+
+/// Returns the name of `op` as declared in this file.
+pub fn name(comptime op: type) []const u8 {
+    const full = @typeName(op);
+    return full[std.mem.lastIndexOfScalar(u8, full, '.').? + 1 ..];
+}
@@ -0,0 +1,49 @@
+//! Compares the helpers called by translated code with the builtins they wrap,
+//! applying each operation of `helper_ops.zig` to arrays of operands.
+const std = @import("std");
+const common = @import("common.zig");
+const helper_ops = @import("helper_ops.zig");
+
+const len = 4096;
+
+pub fn main() !void {
+    var prng: std.Random.DefaultPrng = .init(0);
+    const random = prng.random();
+
+    // Keep denominators positive so every operation is defined for every operand.
+    var a: [len]c_int = undefined;
+    var b: [len]c_int = undefined;
+    for (&a, &b) |*x, *y| {
+        x.* = random.int(c_int);
+        y.* = random.intRangeAtMost(c_int, 1, std.math.maxInt(c_int));
+    }
+
+    common.printHeader("helper", "builtin");
+    inline for (helper_ops.ops) |op| {
+        const helper = Accumulate(op.helper).run;
+        const baseline = Accumulate(op.baseline).run;
+        if (helper(&a, &b) != baseline(&a, &b)) {
+            std.debug.print("{s}: helper result differs from builtin\n", .{helper_ops.name(op)});
+            return error.ResultMismatch;
+        }
+        common.report(
+            helper_ops.name(op),
+            try common.measure(helper, .{ &a, &b }),
+            try common.measure(baseline, .{ &a, &b }),
+        );
+    }
+}
+
+/// Sums the results of `op` over all pairs of operands.
+fn Accumulate(comptime op: anytype) type {
+    const T = @typeInfo(@TypeOf(op)).@"fn".return_type.?;
+    return struct {
+        fn run(a: *const [len]c_int, b: *const [len]c_int) T {
+            var sum: T = 0;
+            for (a, b) |x, y| {
+                if (@typeInfo(T) == .float) sum += op(x, y) else sum +%= op(x, y);
+            }
+            return sum;
+        }
+    };
+}
@@ -0,0 +1,105 @@
+//! Measures the compile time of `__helpers.cast` instantiations. Generates two
+//! files with the same `count` integer conversions, one through the helper and
+//! one through builtins, compiles both with ReleaseFast and reports the extra
+//! compile time per helper instantiation.
+//!
+//! Usage: bench-instantiations <zig> <helpers.zig> <out dir> <count>
+const std = @import("std");
+
+pub fn main() !void {
+    var arena_instance = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_instance.deinit();
+    const arena = arena_instance.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len != 5) {
+        std.debug.print("usage: {s} <zig> <helpers.zig> <out dir> <count>\n", .{args[0]});
+        return error.InvalidArguments;
+    }
+    const zig_exe = args[1];
+    const helpers_path = args[2];
+    const out_dir = args[3];
+    const count = try std.fmt.parseInt(u16, args[4], 10);
+
+    var times: [2]u64 = undefined;
+    for (&times, [_]bool{ true, false }) |*time, use_helper| {
+        const name = if (use_helper) "helper" else "builtin";
+        const source_path = try std.fs.path.join(arena, &.{ out_dir, try std.fmt.allocPrint(arena, "{s}.zig", .{name}) });
+        try writeSource(source_path, count, use_helper);
+
+        // Fresh caches, so that neither compilation reuses results of a previous run.
+        const cache_dir = try std.fs.path.join(arena, &.{ out_dir, try std.fmt.allocPrint(arena, "{s}-cache", .{name}) });
+        const global_cache_dir = try std.fs.path.join(arena, &.{ out_dir, try std.fmt.allocPrint(arena, "{s}-global-cache", .{name}) });
+        try std.fs.cwd().deleteTree(cache_dir);
+        try std.fs.cwd().deleteTree(global_cache_dir);
+
+        var timer = try std.time.Timer.start();
+        const result = try std.process.Child.run(.{
+            .allocator = arena,
+            .argv = &.{
+                zig_exe,
+                "build-obj",
+                "-OReleaseFast",
+                "--cache-dir",
+                cache_dir,
+                "--global-cache-dir",
+                global_cache_dir,
+                "--dep",
+                "helpers",
+                try std.fmt.allocPrint(arena, "-Mroot={s}", .{source_path}),
+                try std.fmt.allocPrint(arena, "-Mhelpers={s}", .{helpers_path}),
+                try std.fmt.allocPrint(arena, "-femit-bin={s}.o", .{source_path}),
+            },
+        });
+        time.* = timer.read();
+        if (result.term != .Exited or result.term.Exited != 0) {
+            std.debug.print("failed to compile {s}:\n{s}\n", .{ source_path, result.stderr });
+            return error.CompileFailed;
+        }
+    }
+
+    const helper_ms = nsToMs(times[0]);
+    const builtin_ms = nsToMs(times[1]);
+    std.debug.print("{d} casts: helper {d:.1} ms, builtin {d:.1} ms, {d:.3} ms per instantiation\n", .{
+        count,
+        helper_ms,
+        builtin_ms,
+        (helper_ms - builtin_ms) / @as(f64, @floatFromInt(count)),
+    });
+}
+
+/// Writes a function converting `count` integers of distinct widths to `c_ulonglong`,
+/// so that every conversion needs its own instantiation of `__helpers.cast`.
+fn writeSource(path: []const u8, count: u16, use_helper: bool) !void {
+    const file = try std.fs.cwd().createFile(path, .{});
+    defer file.close();
+    var buf: [4096]u8 = undefined;
+    var file_writer = file.writer(&buf);
+    const w = &file_writer.interface;
+
+    try w.writeAll(
+        \\const __helpers = @import("helpers");
+        \\
+        \\export fn convert(x: u64) c_ulonglong {
+        \\    var sum: c_ulonglong = 0;
+        \\
+    );
+    for (1..count + 1) |bits| {
+        const wide_bits = @max(bits, 64);
+        if (use_helper) {
+            try w.print("    sum +%= __helpers.cast(c_ulonglong, @as(u{d}, @truncate(@as(u{d}, x))));\n", .{ bits, wide_bits });
+        } else {
+            try w.print("    sum +%= @as(c_ulonglong, @truncate(@as(u{d}, @as(u{d}, @truncate(@as(u{d}, x))))));\n", .{ wide_bits, bits, wide_bits });
+        }
+    }
+    try w.writeAll(
+        \\    return sum;
+        \\}
+        \\
+    );
+    try w.flush();
+}
+
+fn nsToMs(ns: u64) f64 {
+    return @as(f64, @floatFromInt(ns)) / std.time.ns_per_ms;
+}
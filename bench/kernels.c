@@ -0,0 +1,151 @@
+/*
+ * Compute kernels used to compare translated Zig with the original C.
+ * The file is self-contained so it can be translated with -nostdinc.
+ * The C build renames every kernel through KERNEL() so that both versions
+ * can be linked into the same executable.
+ */
+#ifndef KERNEL
+#define KERNEL(name) name
+#endif
+
+/* FNV-1a over a byte buffer. */
+unsigned KERNEL(kernel_hash)(const unsigned char *data, unsigned long len) {
+    unsigned h = 2166136261u;
+    for (unsigned long i = 0; i < len; i++) {
+        h ^= data[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static void sift_down(int *heap, int start, int end) {
+    int root = start;
+    while (2 * root + 1 <= end) {
+        int child = 2 * root + 1;
+        int swap = root;
+        if (heap[swap] < heap[child]) swap = child;
+        if (child + 1 <= end && heap[swap] < heap[child + 1]) swap = child + 1;
+        if (swap == root) return;
+        int tmp = heap[root];
+        heap[root] = heap[swap];
+        heap[swap] = tmp;
+        root = swap;
+    }
+}
+
+/* Copies `input` into `scratch`, heap sorts it and returns a checksum. */
+long KERNEL(kernel_sort)(const int *input, int *scratch, int n) {
+    for (int i = 0; i < n; i++) scratch[i] = input[i];
+    for (int start = (n - 2) / 2; start >= 0; start--) sift_down(scratch, start, n - 1);
+    for (int end = n - 1; end > 0; end--) {
+        int tmp = scratch[end];
+        scratch[end] = scratch[0];
+        scratch[0] = tmp;
+        sift_down(scratch, 0, end - 1);
+    }
+    long sum = 0;
+    for (int i = 0; i < n; i++) sum += (long)scratch[i] * (i + 1);
+    return sum;
+}
+
+/* Counts the words, vowels and digits of a NUL-terminated string. */
+unsigned long KERNEL(kernel_words)(const char *text) {
+    unsigned long words = 0, vowels = 0, digits = 0;
+    int in_word = 0;
+    for (const char *p = text; *p; p++) {
+        char c = *p;
+        if (c >= 'A' && c <= 'Z') c = (char)(c - 'A' + 'a');
+        if (c == ' ' || c == '\n' || c == '\t') {
+            in_word = 0;
+            continue;
+        }
+        if (!in_word) words++;
+        in_word = 1;
+        if (c == 'a' || c == 'e' || c == 'i' || c == 'o' || c == 'u') vowels++;
+        if (c >= '0' && c <= '9') digits++;
+    }
+    return words * 1000000 + vowels * 1000 + digits;
+}
+
+/* Multiplies two n x n row-major matrices. */
+void KERNEL(kernel_matmul)(const float *a, const float *b, float *out, int n) {
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) out[i * n + j] = 0;
+        for (int k = 0; k < n; k++) {
+            float aik = a[i * n + k];
+            for (int j = 0; j < n; j++) out[i * n + j] += aik * b[k * n + j];
+        }
+    }
+}
+
+/* Dot product through plain pointers, which translate to [*c]T. */
+long KERNEL(kernel_dot)(const int *a, const int *b, int n) {
+    long sum = 0;
+    for (int i = 0; i < n; i++) sum += (long)a[i] * b[i];
+    return sum;
+}
+
+/* The same through `static` array parameters, which translate to [*]T. */
+long KERNEL(kernel_dot_static)(const int a[static 4096], const int b[static 4096], int n) {
+    long sum = 0;
+    for (int i = 0; i < n; i++) sum += (long)a[i] * b[i];
+    return sum;
+}
+
+enum lex_state { LEX_START, LEX_IDENT, LEX_NUMBER, LEX_STRING, LEX_COMMENT };
+
+/* Counts the tokens of a C-like source string with a switch based state machine. */
+int KERNEL(kernel_lexer)(const char *src) {
+    enum lex_state state = LEX_START;
+    int tokens = 0;
+    for (const char *p = src;; p++) {
+        char c = *p;
+        switch (state) {
+        case LEX_START:
+            switch (c) {
+            case '\0':
+                return tokens;
+            case ' ':
+            case '\n':
+            case '\t':
+                break;
+            case '"':
+                state = LEX_STRING;
+                break;
+            case '#':
+                state = LEX_COMMENT;
+                break;
+            case '0': case '1': case '2': case '3': case '4':
+            case '5': case '6': case '7': case '8': case '9':
+                state = LEX_NUMBER;
+                break;
+            case '(': case ')': case '{': case '}': case ';': case ',':
+            case '+': case '-': case '*': case '/': case '=': case '<': case '>':
+                tokens++;
+                break;
+            default:
+                state = LEX_IDENT;
+                break;
+            }
+            break;
+        case LEX_IDENT:
+        case LEX_NUMBER:
+            if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_') break;
+            tokens++;
+            state = LEX_START;
+            p--;
+            break;
+        case LEX_STRING:
+            if (c == '\0') return tokens;
+            if (c == '"') {
+                tokens++;
+                state = LEX_START;
+            }
+            break;
+        case LEX_COMMENT:
+            if (c == '\0') return tokens;
+            if (c == '\n') state = LEX_START;
+            break;
+        }
+    }
+}
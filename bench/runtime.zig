@@ -0,0 +1,91 @@
+//! Compares the kernels of `bench/kernels.c` translated to Zig with the same
+//! kernels compiled as C. Both are built with ReleaseFast, so the ratios show
+//! the cost of the generated code, such as `[*c]` pointers and helper casts.
+const std = @import("std");
+const translated = @import("kernels");
+const common = @import("common.zig");
+
+const native = struct {
+    extern fn c_kernel_hash(data: [*c]const u8, len: c_ulong) c_uint;
+    extern fn c_kernel_sort(input: [*c]const c_int, scratch: [*c]c_int, n: c_int) c_long;
+    extern fn c_kernel_words(text: [*c]const u8) c_ulong;
+    extern fn c_kernel_dot(a: [*c]const c_int, b: [*c]const c_int, n: c_int) c_long;
+    extern fn c_kernel_dot_static(a: [*c]const c_int, b: [*c]const c_int, n: c_int) c_long;
+    extern fn c_kernel_matmul(a: [*c]const f32, b: [*c]const f32, out: [*c]f32, n: c_int) void;
+    extern fn c_kernel_lexer(src: [*c]const u8) c_int;
+};
+
+const data_len = 64 * 1024;
+const sort_len = 4096;
+const matrix_n = 64;
+
+const sample_source =
+    \\# a comment line
+    \\static int add_one(int value) { return value + 1; }
+    \\int main(void) { const char *s = "hello, world"; int x = 42 * (7 - 3); return add_one(x) < 100; }
+    \\
+;
+
+pub fn main() !void {
+    const gpa = std.heap.page_allocator;
+    var prng: std.Random.DefaultPrng = .init(0);
+    const random = prng.random();
+
+    const bytes = try gpa.alloc(u8, data_len);
+    defer gpa.free(bytes);
+    random.bytes(bytes);
+
+    const ints = try gpa.alloc(c_int, sort_len);
+    defer gpa.free(ints);
+    for (ints) |*int| int.* = random.int(c_int);
+    const scratch = try gpa.alloc(c_int, sort_len);
+    defer gpa.free(scratch);
+
+    // Small enough that the dot products cannot overflow a 32-bit `long`.
+    const dot_operands = try gpa.alloc(c_int, 2 * sort_len);
+    defer gpa.free(dot_operands);
+    for (dot_operands) |*int| int.* = random.intRangeAtMost(c_int, -500, 500);
+    const dot_a = dot_operands[0..sort_len];
+    const dot_b = dot_operands[sort_len..];
+
+    // Words of random length separated by spaces and newlines.
+    const text = try gpa.allocSentinel(u8, data_len, 0);
+    defer gpa.free(text);
+    for (text) |*c| c.* = switch (random.uintLessThan(u8, 10)) {
+        0 => ' ',
+        1 => '\n',
+        2 => random.intRangeAtMost(u8, '0', '9'),
+        else => random.intRangeAtMost(u8, 'a', 'z'),
+    };
+
+    const matrices = try gpa.alloc(f32, 3 * matrix_n * matrix_n);
+    defer gpa.free(matrices);
+    for (matrices) |*x| x.* = random.float(f32);
+    const a = matrices[0 .. matrix_n * matrix_n];
+    const b = matrices[matrix_n * matrix_n ..][0 .. matrix_n * matrix_n];
+    const out = matrices[2 * matrix_n * matrix_n ..];
+
+    const source = try gpa.allocSentinel(u8, sample_source.len * 256, 0);
+    defer gpa.free(source);
+    for (0..256) |i| @memcpy(source[i * sample_source.len ..][0..sample_source.len], sample_source);
+
+    common.printHeader("translated", "c");
+    try run("hash", translated.kernel_hash, native.c_kernel_hash, .{ bytes.ptr, @as(c_ulong, data_len) });
+    try run("sort", translated.kernel_sort, native.c_kernel_sort, .{ ints.ptr, scratch.ptr, @as(c_int, sort_len) });
+    try run("words", translated.kernel_words, native.c_kernel_words, .{text.ptr});
+    // `kernel_dot_static` only differs in translating its parameters as `[*]T`.
+    try run("dot [*c]T", translated.kernel_dot, native.c_kernel_dot, .{ dot_a.ptr, dot_b.ptr, @as(c_int, sort_len) });
+    try run("dot [*]T", translated.kernel_dot_static, native.c_kernel_dot_static, .{ dot_a.ptr, dot_b.ptr, @as(c_int, sort_len) });
+    try run("matmul", translated.kernel_matmul, native.c_kernel_matmul, .{ a.ptr, b.ptr, out.ptr, @as(c_int, matrix_n) });
+    try run("lexer", translated.kernel_lexer, native.c_kernel_lexer, .{source.ptr});
+}
+
+fn run(name: []const u8, comptime zig_fn: anytype, comptime c_fn: anytype, args: anytype) !void {
+    const zig_result = @call(.auto, zig_fn, args);
+    const c_result = @call(.auto, c_fn, args);
+    if (@TypeOf(zig_result) != void and zig_result != c_result) {
+        std.debug.print("{s}: translated result differs from C\n", .{name});
+        return error.ResultMismatch;
+    }
+    common.report(name, try common.measure(zig_fn, args), try common.measure(c_fn, args));
+}
@@ -0,0 +1,68 @@
+//! Compares translating static locals wrapped in local structs with hoisting
+//! them to file scope (`-fhoist-static-locals`): the size of the generated Zig
+//! source, the time to compile it and the size of the resulting object.
+//!
+//! Usage: bench-static-locals <zig> <c_builtins.zig> <helpers.zig> <out dir> <wrapped.zig> <hoisted.zig>
+const std = @import("std");
+
+const Variant = struct {
+    name: []const u8,
+    source: []const u8,
+};
+
+pub fn main() !void {
+    var arena_instance = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_instance.deinit();
+    const arena = arena_instance.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len != 7) {
+        std.debug.print("usage: {s} <zig> <c_builtins.zig> <helpers.zig> <out dir> <wrapped.zig> <hoisted.zig>\n", .{args[0]});
+        return error.InvalidArguments;
+    }
+    const zig_exe = args[1];
+    const c_builtins_path = args[2];
+    const helpers_path = args[3];
+    const out_dir = args[4];
+    const variants = [_]Variant{
+        .{ .name = "wrapped", .source = args[5] },
+        .{ .name = "hoisted", .source = args[6] },
+    };
+
+    std.debug.print("{s:<10} {s:>12} {s:>12} {s:>12}\n", .{ "variant", "source", "compile", "object" });
+    for (variants) |variant| {
+        const source_size = (try std.fs.cwd().statFile(variant.source)).size;
+        const object_path = try std.fs.path.join(arena, &.{ out_dir, try std.fmt.allocPrint(arena, "{s}.o", .{variant.name}) });
+
+        var timer = try std.time.Timer.start();
+        const result = try std.process.Child.run(.{
+            .allocator = arena,
+            .argv = &.{
+                zig_exe,
+                "build-obj",
+                "-OReleaseFast",
+                "--dep",
+                "c_builtins",
+                "--dep",
+                "helpers",
+                try std.fmt.allocPrint(arena, "-Mroot={s}", .{variant.source}),
+                try std.fmt.allocPrint(arena, "-Mc_builtins={s}", .{c_builtins_path}),
+                try std.fmt.allocPrint(arena, "-Mhelpers={s}", .{helpers_path}),
+                try std.fmt.allocPrint(arena, "-femit-bin={s}", .{object_path}),
+            },
+        });
+        const compile_ns = timer.read();
+        if (result.term != .Exited or result.term.Exited != 0) {
+            std.debug.print("failed to compile {s}:\n{s}\n", .{ variant.source, result.stderr });
+            return error.CompileFailed;
+        }
+        const object_size = (try std.fs.cwd().statFile(object_path)).size;
+
+        std.debug.print("{s:<10} {d:>10} B {d:>9.1} ms {d:>10} B\n", .{
+            variant.name,
+            source_size,
+            @as(f64, @floatFromInt(compile_ns)) / std.time.ns_per_ms,
+            object_size,
+        });
+    }
+}
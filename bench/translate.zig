@@ -0,0 +1,73 @@
+//! Runs translate-c on each input header several times and reports the wall
+//! time, the peak RSS of the translate-c process and the size of the output.
+//!
+//! Usage: bench-translate <translate-c> <resource dir> <iterations> <out dir> <input.h>...
+//!
+//! The inputs must be self-contained; they are translated with `-nostdinc`.
+const std = @import("std");
+
+pub fn main() !void {
+    var arena_instance = std.heap.ArenaAllocator.init(std.heap.page_allocator);
+    defer arena_instance.deinit();
+    const arena = arena_instance.allocator();
+
+    const args = try std.process.argsAlloc(arena);
+    if (args.len < 6) {
+        std.debug.print("usage: {s} <translate-c> <resource dir> <iterations> <out dir> <input.h>...\n", .{args[0]});
+        return error.InvalidArguments;
+    }
+    const translate_c = args[1];
+    const resource_dir = args[2];
+    const iterations = @max(try std.fmt.parseInt(usize, args[3], 10), 1);
+    const out_dir = args[4];
+
+    std.debug.print("{s:<24} {s:>12} {s:>12} {s:>12} {s:>12}\n", .{ "input", "min", "mean", "peak rss", "output" });
+    for (args[5..]) |input| {
+        const name = std.fs.path.stem(input);
+        const output = try std.fs.path.join(arena, &.{ out_dir, try std.fmt.allocPrint(arena, "{s}.zig", .{name}) });
+
+        var min_ns: u64 = std.math.maxInt(u64);
+        var total_ns: u64 = 0;
+        var peak_rss: usize = 0;
+        for (0..iterations) |_| {
+            var child: std.process.Child = .init(&.{
+                translate_c,
+                input,
+                "-o",
+                output,
+                "-resource-dir",
+                resource_dir,
+                "-nostdinc",
+                "-fmodule-libs",
+                "-w",
+            }, arena);
+            child.stdout_behavior = .Ignore;
+            child.request_resource_usage_statistics = true;
+
+            var timer = try std.time.Timer.start();
+            const term = try child.spawnAndWait();
+            const ns = timer.read();
+            if (term != .Exited or term.Exited != 0) {
+                std.debug.print("translate-c failed on {s}\n", .{input});
+                return error.TranslateFailed;
+            }
+
+            min_ns = @min(min_ns, ns);
+            total_ns += ns;
+            peak_rss = @max(peak_rss, child.resource_usage_statistics.getMaxRss() orelse 0);
+        }
+        const output_size = (try std.fs.cwd().statFile(output)).size;
+
+        std.debug.print("{s:<24} {d:>9.1} ms {d:>9.1} ms {d:>8} KiB {d:>8} KiB\n", .{
+            name,
+            nsToMs(min_ns),
+            nsToMs(total_ns) / @as(f64, @floatFromInt(iterations)),
+            peak_rss / 1024,
+            output_size / 1024,
+        });
+    }
+}
+
+fn nsToMs(ns: u64) f64 {
+    return @as(f64, @floatFromInt(ns)) / std.time.ns_per_ms;
+}
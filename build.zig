@@ -8,6 +8,8 @@ pub fn build(b: *std.Build) void {
     const test_cross_targets = b.option(bool, "test-cross-targets", "Include cross-translation targets in the test cases") orelse false;
     const use_llvm = b.option(bool, "llvm", "Use LLVM backend to generate aro executable");
     const link_libc = b.option(bool, "link-libc", "Link libc") orelse (optimize != .Debug);
+    const bench_decls = b.option(usize, "bench-decls", "Thousands of declarations in the generated benchmark header") orelse 20;
+    const bench_iterations = b.option(usize, "bench-iterations", "Number of times each benchmark header is translated") orelse 5;
 
     const aro = b.dependency("aro", .{
         .target = target,
@@ -79,7 +81,7 @@ pub fn build(b: *std.Build) void {
         break :step &run_cmd.step;
     });
 
-    const fmt_dirs: []const []const u8 = &.{ "build", "build.zig", "src", "lib", "test", "examples" };
+    const fmt_dirs: []const []const u8 = &.{ "bench", "build", "build.zig", "src", "lib", "test", "examples" };
 
     const fmt_step = b.step("fmt", "Modify source files in place to have conforming formatting");
     fmt_step.dependOn(&b.addFmt(.{ .paths = fmt_dirs }).step);
@@ -120,6 +122,62 @@ pub fn build(b: *std.Build) void {
         break :step &b.addRunArtifact(b.addTest(.{ .root_module = macro_tests_mod })).step;
     });
 
+    const test_base_step = b.step("test-base", "Run tests of translations sharing a base translation");
+    test_base_step.dependOn(step: {
+        const base_tests_mod = b.createModule(.{
+            .root_source_file = b.path("test/base.zig"),
+            .target = target,
+            .optimize = optimize,
+        });
+        const base = Translator.initInner(b, translator_conf, .{
+            .c_source_file = b.path("test/base.h"),
+            .target = target,
+            .optimize = optimize,
+            .emit_names = true,
+        });
+        const derived = Translator.initInner(b, translator_conf, .{
+            .c_source_file = b.path("test/derived.h"),
+            .target = target,
+            .optimize = optimize,
+            .base = &base,
+        });
+        base_tests_mod.addImport("base.h", base.mod);
+        base_tests_mod.addImport("derived.h", derived.mod);
+        break :step &b.addRunArtifact(b.addTest(.{ .root_module = base_tests_mod })).step;
+    });
+
+    const test_split_step = b.step("test-split", "Run tests of translations split into one file per header");
+    test_split_step.dependOn(step: {
+        const split_tests_mod = b.createModule(.{
+            .root_source_file = b.path("test/split.zig"),
+            .target = target,
+            .optimize = optimize,
+        });
+        split_tests_mod.addImport("split.h", Translator.initInner(b, translator_conf, .{
+            .c_source_file = b.path("test/split/split.h"),
+            .target = target,
+            .optimize = optimize,
+            .split_output = true,
+        }).mod);
+        break :step &b.addRunArtifact(b.addTest(.{ .root_module = split_tests_mod })).step;
+    });
+
+    const test_stats_step = b.step("test-stats", "Check the --stats report of a header with untranslatable declarations");
+    test_stats_step.dependOn(step: {
+        const run = b.addRunArtifact(translate_c_exe);
+        run.addFileArg(b.path("test/stats.h"));
+        run.addArg("-o");
+        _ = run.addOutputFileArg("stats.zig");
+        const stats_json = run.addPrefixedOutputFileArg("--stats=", "stats.json");
+        break :step &b.addCheckFile(stats_json, .{ .expected_matches = &.{
+            "\"demoted_functions\": {\n    \"count\": 1,",
+            "{ \"name\": \"uses_goto\", \"reason\": \"TODO goto\", \"message\": \"unable to translate function, demoted to extern\"",
+            "\"opaque_demotions\": {\n    \"count\": 1,",
+            "\"reason\": \"{s} demoted to opaque type - has bitfield\", \"message\": \"struct demoted to opaque type - has bitfield\"",
+            "{ \"name\": \"UNBALANCED\",",
+        } }).step;
+    });
+
     const test_translate_step = b.step("test-translate", "Run the C translation tests");
     const test_run_translated_step = b.step("test-run-translated", "Run the run-translated-c tests");
     @import("test/cases.zig").lowerCases(
@@ -132,12 +190,206 @@ pub fn build(b: *std.Build) void {
         test_run_translated_step,
     );
 
+    const bench_step = b.step("bench", "Measure translate-c on a generated corpus and the vendored headers");
+    bench_step.dependOn(step: {
+        const corpus_exe = b.addExecutable(.{
+            .name = "bench-corpus",
+            .root_module = b.createModule(.{
+                .root_source_file = b.path("bench/corpus.zig"),
+                .target = b.graph.host,
+                .optimize = .ReleaseFast,
+            }),
+        });
+        const gen_corpus = b.addRunArtifact(corpus_exe);
+        gen_corpus.addArg(b.fmt("{d}", .{bench_decls}));
+        const synthetic_h = gen_corpus.addOutputFileArg("synthetic.h");
+
+        const translate_exe = b.addExecutable(.{
+            .name = "bench-translate",
+            .root_module = b.createModule(.{
+                .root_source_file = b.path("bench/translate.zig"),
+                .target = b.graph.host,
+                .optimize = .ReleaseFast,
+            }),
+        });
+        const run = b.addRunArtifact(translate_exe);
+        run.addArtifactArg(translate_c_exe);
+        run.addDirectoryArg(aro.path(""));
+        run.addArg(b.fmt("{d}", .{bench_iterations}));
+        _ = run.addOutputDirectoryArg("out");
+        run.addFileArg(synthetic_h);
+        run.addFileArg(b.path("bench/headers/gfx_api.h"));
+        run.has_side_effects = true;
+        break :step &run.step;
+    });
+
+    const bench_runtime_step = b.step("bench-runtime", "Compare the speed of translated kernels with the same kernels compiled as C");
+    bench_runtime_step.dependOn(step: {
+        const kernels = Translator.initInner(b, translator_conf, .{
+            .c_source_file = b.path("bench/kernels.c"),
+            .target = target,
+            .optimize = .ReleaseFast,
+            .link_libc = false,
+        });
+        const bench_mod = b.createModule(.{
+            .root_source_file = b.path("bench/runtime.zig"),
+            .target = target,
+            .optimize = .ReleaseFast,
+        });
+        bench_mod.addImport("kernels", kernels.mod);
+        bench_mod.addCSourceFile(.{
+            .file = b.path("bench/kernels.c"),
+            .flags = &.{"-DKERNEL(name)=c_##name"},
+        });
+        const bench_exe = b.addExecutable(.{
+            .name = "bench-runtime",
+            .root_module = bench_mod,
+        });
+        break :step &b.addRunArtifact(bench_exe).step;
+    });
+
+    const bench_lib_step = b.step("bench-lib", "Benchmark the helpers and builtins used by translated code");
+    bench_lib_step.dependOn(step: {
+        const bench_mod = b.createModule(.{
+            .root_source_file = b.path("bench/c_builtins.zig"),
+            .target = target,
+            .optimize = .ReleaseFast,
+            .link_libc = true,
+        });
+        bench_mod.addImport("c_builtins", c_builtins);
+        const bench_exe = b.addExecutable(.{
+            .name = "bench-c-builtins",
+            .root_module = bench_mod,
+        });
+        break :step &b.addRunArtifact(bench_exe).step;
+    });
+    bench_lib_step.dependOn(step: {
+        const bench_mod = b.createModule(.{
+            .root_source_file = b.path("bench/helpers.zig"),
+            .target = target,
+            .optimize = .ReleaseFast,
+        });
+        bench_mod.addImport("helpers", helpers);
+        bench_mod.addImport("c_builtins", c_builtins);
+        const bench_exe = b.addExecutable(.{
+            .name = "bench-helpers",
+            .root_module = bench_mod,
+        });
+        break :step &b.addRunArtifact(bench_exe).step;
+    });
+    bench_lib_step.dependOn(step: {
+        const codegen_mod = b.createModule(.{
+            .root_source_file = b.path("bench/codegen.zig"),
+            .target = target,
+            .optimize = .ReleaseFast,
+        });
+        codegen_mod.addImport("helpers", helpers);
+        codegen_mod.addImport("c_builtins", c_builtins);
+        const codegen_obj = b.addObject(.{
+            .name = "codegen",
+            .root_module = codegen_mod,
+        });
+
+        const check_mod = b.createModule(.{
+            .root_source_file = b.path("bench/check_codegen.zig"),
+            .target = b.graph.host,
+            .optimize = .ReleaseFast,
+        });
+        check_mod.addImport("helpers", helpers);
+        check_mod.addImport("c_builtins", c_builtins);
+        const check_exe = b.addExecutable(.{
+            .name = "check-codegen",
+            .root_module = check_mod,
+        });
+        const run = b.addRunArtifact(check_exe);
+        run.addFileArg(codegen_obj.getEmittedAsm());
+        break :step &run.step;
+    });
+    bench_lib_step.dependOn(step: {
+        const bench_exe = b.addExecutable(.{
+            .name = "bench-instantiations",
+            .root_module = b.createModule(.{
+                .root_source_file = b.path("bench/instantiations.zig"),
+                .target = b.graph.host,
+                .optimize = .ReleaseFast,
+            }),
+        });
+        const run = b.addRunArtifact(bench_exe);
+        run.addArg(b.graph.zig_exe);
+        run.addFileArg(b.path("lib/helpers.zig"));
+        _ = run.addOutputDirectoryArg("instantiations");
+        run.addArg("256");
+        run.has_side_effects = true;
+        break :step &run.step;
+    });
+
+    const bench_static_locals_step = b.step("bench-static-locals", "Compare wrapped and hoisted static locals in generated code");
+    bench_static_locals_step.dependOn(step: {
+        const corpus = b.addWriteFiles().add("static_locals.c", staticLocalsCorpus(b, 256));
+        const wrapped = Translator.initInner(b, translator_conf, .{
+            .name = "wrapped",
+            .c_source_file = corpus,
+            .target = target,
+            .optimize = .ReleaseFast,
+            .link_libc = false,
+        });
+        const hoisted = Translator.initInner(b, translator_conf, .{
+            .name = "hoisted",
+            .c_source_file = corpus,
+            .target = target,
+            .optimize = .ReleaseFast,
+            .link_libc = false,
+            .hoist_static_locals = true,
+        });
+        const bench_exe = b.addExecutable(.{
+            .name = "bench-static-locals",
+            .root_module = b.createModule(.{
+                .root_source_file = b.path("bench/static_locals.zig"),
+                .target = b.graph.host,
+                .optimize = .ReleaseFast,
+            }),
+        });
+        const run = b.addRunArtifact(bench_exe);
+        run.addArg(b.graph.zig_exe);
+        run.addFileArg(b.path("lib/c_builtins.zig"));
+        run.addFileArg(b.path("lib/helpers.zig"));
+        _ = run.addOutputDirectoryArg("objects");
+        run.addFileArg(wrapped.output_file);
+        run.addFileArg(hoisted.output_file);
+        run.has_side_effects = true;
+        break :step &run.step;
+    });
+
     const test_step = b.step("test", "Run all tests");
     test_step.dependOn(test_fmt_step);
     test_step.dependOn(test_unit_step);
     test_step.dependOn(test_macros_step);
+    test_step.dependOn(test_base_step);
+    test_step.dependOn(test_split_step);
+    test_step.dependOn(test_stats_step);
     if (!skip_translate) test_step.dependOn(test_translate_step);
     if (!skip_run_translated) test_step.dependOn(test_run_translated_step);
 }
 
+/// Generates `count` C functions that each keep their state in static locals.
+fn staticLocalsCorpus(b: *std.Build, count: usize) []const u8 {
+    var source: std.ArrayList(u8) = .empty;
+    for (0..count) |i| {
+        source.print(b.allocator,
+            \\int counter_{d}(int step) {{
+            \\    static int total = {d};
+            \\    static int history[16];
+            \\    static _Thread_local int calls;
+            \\    static int *last = &total;
+            \\    history[calls++ & 15] = step;
+            \\    total += step;
+            \\    last = &history[calls & 15];
+            \\    return total + *last;
+            \\}}
+            \\
+        , .{ i, i }) catch @panic("OOM");
+    }
+    return source.items;
+}
+
 const std = @import("std");
@@ -33,6 +33,10 @@ output_file: Build.LazyPath,
 /// if calling a method such as `Build.Module.addIncludePath`.
 mod: *Build.Module,
 
+/// Lists the public declarations of `output_file`, one per line. Used by translations whose
+/// `Options.base` is this one. Only written if `Options.emit_names` is set.
+names_file: ?Build.LazyPath,
+
 /// The `Build.Step.Run` which is actually running translate-c. This can be modified directly to
 /// add custom arguments, but prefer using methods like `linkLibrary` where possible.
 run: *Build.Step.Run,
@@ -47,10 +51,30 @@ pub const Options = struct {
     target: Build.ResolvedTarget,
     optimize: std.builtin.OptimizeMode,
     module_libs: bool = true,
+    /// Translate `static inline` functions as Zig `inline fn`s, matching how C compilers
+    /// inline them at call sites when optimizing.
+    inline_static_fns: bool = false,
+    /// Translate static local variables as uniquely named file scope variables instead of
+    /// wrapping each one in a local struct.
+    hoist_static_locals: bool = false,
+    /// Write the declarations of each header to a separate file next to `output_file`, which
+    /// only re-exports them. Zig then only parses the files whose declarations are used.
+    split_output: bool = false,
+    /// Write `names_file`, which is required for this translation to be the `base` of others.
+    emit_names: bool = false,
     link_libc: bool = true,
-    warnings: enum { ignore, show, @"error" } = .ignore,
+    warnings: Warnings = .ignore,
+    /// A translation of headers which this one includes, typically a wrapper including common
+    /// system headers, for the same target. Declarations and macros it already declares are
+    /// aliased from `base.mod` instead of being translated and compiled again, so that any
+    /// number of `Translator`s can share one translation of the headers they have in common.
+    /// It must have been created with `emit_names` set.
+    base: ?*const Translator = null,
 };
 
+/// The name under which `Options.base` is imported by the generated Zig source file.
+const base_import_name = "translate_c_base";
+
 pub fn init(translate_c_dep: *Build.Dependency, options: Options) Translator {
     return initInner(translate_c_dep.builder, .{
         .exe = translate_c_dep.artifact("translate-c"),
@@ -90,18 +114,110 @@ pub fn initInner(
     mod.addImport("c_builtins", tc_conf.c_builtins);
     mod.addImport("helpers", tc_conf.helpers);
 
-    if (!options.target.query.isNative()) {
-        const triple = options.target.query.zigTriple(b.graph.arena) catch @panic("OOM");
+    addCommonArgs(b, tc_conf, run, options.target, options.link_libc, options.warnings);
+
+    if (options.module_libs) {
+        run.addArg("-fmodule-libs");
+    }
+    if (options.inline_static_fns) {
+        run.addArg("-finline-static-fns");
+    }
+    if (options.hoist_static_locals) {
+        run.addArg("-fhoist-static-locals");
+    }
+    if (options.split_output) {
+        run.addArg("-fsplit-output");
+    }
+    const names_file = if (options.emit_names)
+        run.addPrefixedOutputFileArg("--names-out=", b.fmt("{s}.names", .{name}))
+    else
+        null;
+    if (options.base) |base| {
+        const base_names = base.names_file orelse
+            @panic("the base of a translation must be created with emit_names set");
+        run.addArg("--base-module=" ++ base_import_name);
+        run.addPrefixedFileArg("--base-names=", base_names);
+        mod.addImport(base_import_name, base.mod);
+    }
+
+    return .{
+        .output_file = output_file,
+        .names_file = names_file,
+        .mod = mod,
+        .run = run,
+    };
+}
+
+pub const Warnings = enum { ignore, show, @"error" };
+
+pub const BatchOptions = struct {
+    /// Used to name the `Build.Step.Run` and the output directory.
+    name: []const u8,
+    /// A file listing the C source files to translate, one per line. Each path is relative to the
+    /// directory containing this file and may be followed by tab separated options such as
+    /// `-finline-static-fns` which only apply to that file.
+    batch_file: Build.LazyPath,
+    target: Build.ResolvedTarget,
+    module_libs: bool = true,
+    link_libc: bool = true,
+    warnings: Warnings = .ignore,
+};
+
+pub const Batch = struct {
+    /// Contains the translation of each file listed in the batch file, at the same relative path
+    /// but with the extension replaced by ".zig".
+    output_dir: Build.LazyPath,
+    run: *Build.Step.Run,
+};
+
+/// Intended for use only by the translate-c package itself. Translates every file listed in a batch
+/// file with a single translate-c process, which only has to discover the toolchain once. Unlike
+/// `initInner`, no modules are created, and header dependencies are not tracked, so changes to
+/// included headers outside of the batch file's directory do not invalidate the cached results.
+pub fn initBatch(
+    b: *Build,
+    tc_conf: TranslateCConfig,
+    options: BatchOptions,
+) Batch {
+    const run = b.addRunArtifact(tc_conf.exe);
+    run.setName(b.fmt("translate-c {s}", .{options.name}));
+    run.addPrefixedFileArg("--batch=", options.batch_file);
+    run.addArg("-o");
+    const output_dir = run.addOutputDirectoryArg(options.name);
+
+    addCommonArgs(b, tc_conf, run, options.target, options.link_libc, options.warnings);
+
+    if (options.module_libs) {
+        run.addArg("-fmodule-libs");
+    }
+
+    return .{
+        .output_dir = output_dir,
+        .run = run,
+    };
+}
+
+/// Adds the arguments selecting the target, the include directories and the warning level.
+fn addCommonArgs(
+    b: *Build,
+    tc_conf: TranslateCConfig,
+    run: *Build.Step.Run,
+    target: Build.ResolvedTarget,
+    link_libc: bool,
+    warnings: Warnings,
+) void {
+    if (!target.query.isNative()) {
+        const triple = target.query.zigTriple(b.graph.arena) catch @panic("OOM");
         run.addArg(b.fmt("--target={s}", .{triple}));
     }
-    if (options.link_libc) {
+    if (link_libc) {
         // If we're cross-compiling, we need to use Zig's libc directories.
         //
         // Currently calling into Zig's libc detection is also necessary for native targets other
         // than Linux due to deficiencies in Aro's toolchains for non-Linux targets.
-        if (!options.target.query.isNative() or options.target.result.os.tag != .linux) {
+        if (!target.query.isNative() or target.result.os.tag != .linux) {
             run.addArg("-nostdlibinc"); // Aro should still check its builtin dir, but we're providing everything else
-            const libc = detectLibCDirs(b, &options.target);
+            const libc = detectLibCDirs(b, &target);
             for (libc.libc_include_dir_list) |include_dir| {
                 appendIncludeArg(run, "-isystem", .{ .cwd_relative = include_dir });
             }
@@ -118,8 +234,8 @@ pub fn initInner(
         run.addArg("-nostdinc");
     }
 
-    if (options.target.query.isNativeOs() and options.target.query.isNativeAbi() and options.link_libc) {
-        const paths = std.zig.system.NativePaths.detect(b.graph.arena, &options.target.result) catch |err| {
+    if (target.query.isNativeOs() and target.query.isNativeAbi() and link_libc) {
+        const paths = std.zig.system.NativePaths.detect(b.graph.arena, &target.result) catch |err| {
             std.debug.panic("failed to detect native system paths: {t}", .{err});
         };
         for (paths.warnings.items) |warning| {
@@ -136,23 +252,13 @@ pub fn initInner(
         // semantic analysis, so only needs to know include paths.
     }
 
-    switch (options.warnings) {
+    switch (warnings) {
         .ignore => run.addArg("-w"),
         .show => {},
         .@"error" => run.addArg("-Werror"),
     }
 
     appendIncludeArg(run, "-resource-dir", tc_conf.aro_resource_dir);
-
-    if (options.module_libs) {
-        run.addArg("-fmodule-libs");
-    }
-
-    return .{
-        .output_file = output_file,
-        .mod = mod,
-        .run = run,
-    };
 }
 /// Intended for use only by the translate-c package itself.
 pub const TranslateCConfig = struct {
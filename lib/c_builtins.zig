@@ -5,10 +5,24 @@ pub inline fn abs(val: c_int) c_int {
     return if (val == std.math.minInt(c_int)) val else @intCast(@abs(val));
 }
 
+/// Adds `a` and `b` with infinite precision and stores the result in the type
+/// `result` points to. Returns true if the result does not fit, in which case the
+/// truncated value is stored.
+pub inline fn add_overflow(a: anytype, b: anytype, result: anytype) bool {
+    const Wide = OverflowInt(@TypeOf(result.*), @TypeOf(a), @TypeOf(b));
+    return storeOverflow(@as(Wide, a) + @as(Wide, b), result);
+}
+
 pub inline fn assume(cond: bool) void {
     if (!cond) unreachable;
 }
 
+/// The optional offset argument of the C builtin is not supported; translate-c demotes
+/// functions which pass it.
+pub inline fn assume_aligned(ptr: ?*const anyopaque, comptime alignment: usize) ?*align(alignment) anyopaque {
+    return @alignCast(@constCast(ptr));
+}
+
 pub inline fn bswap16(val: u16) u16 {
     return @byteSwap(val);
 }
@@ -36,6 +50,18 @@ pub inline fn clz(val: c_uint) c_int {
     return @as(c_int, @bitCast(@as(c_uint, @clz(val))));
 }
 
+/// Same as `clz` but for a c_ulong.
+pub inline fn clzl(val: c_ulong) c_int {
+    @setRuntimeSafety(false);
+    return @clz(val);
+}
+
+/// Same as `clz` but for a c_ulonglong.
+pub inline fn clzll(val: c_ulonglong) c_int {
+    @setRuntimeSafety(false);
+    return @clz(val);
+}
+
 pub inline fn constant_p(expr: anytype) c_int {
     _ = expr;
     return @intFromBool(false);
@@ -56,6 +82,43 @@ pub inline fn ctz(val: c_uint) c_int {
     return @as(c_int, @bitCast(@as(c_uint, @ctz(val))));
 }
 
+/// Same as `ctz` but for a c_ulong.
+pub inline fn ctzl(val: c_ulong) c_int {
+    @setRuntimeSafety(false);
+    return @ctz(val);
+}
+
+/// Same as `ctz` but for a c_ulonglong.
+pub inline fn ctzll(val: c_ulonglong) c_int {
+    @setRuntimeSafety(false);
+    return @ctz(val);
+}
+
+/// Absolute value of each element. Unlike `@abs`, the result has the type of
+/// `val`, so the absolute value of the most negative integer remains negative.
+pub inline fn elementwise_abs(val: anytype) @TypeOf(val) {
+    return switch (@typeInfo(Scalar(@TypeOf(val)))) {
+        .int => @bitCast(@abs(val)),
+        else => @abs(val),
+    };
+}
+
+pub inline fn elementwise_add_sat(a: anytype, b: anytype) @TypeOf(a, b) {
+    return a +| b;
+}
+
+pub inline fn elementwise_max(a: anytype, b: anytype) @TypeOf(a, b) {
+    return @max(a, b);
+}
+
+pub inline fn elementwise_min(a: anytype, b: anytype) @TypeOf(a, b) {
+    return @min(a, b);
+}
+
+pub inline fn elementwise_sub_sat(a: anytype, b: anytype) @TypeOf(a, b) {
+    return a -| b;
+}
+
 pub inline fn exp2f(val: f32) f32 {
     return @exp2(val);
 }
@@ -104,6 +167,378 @@ pub inline fn huge_valf() f32 {
     return std.math.inf(f32);
 }
 
+pub inline fn ia32_cmpeqpd(a: @Vector(2, f64), b: @Vector(2, f64)) @Vector(2, f64) {
+    return compareMask(a, b, 0);
+}
+
+pub inline fn ia32_cmpeqps(a: @Vector(4, f32), b: @Vector(4, f32)) @Vector(4, f32) {
+    return compareMask(a, b, 0);
+}
+
+pub inline fn ia32_cmplepd(a: @Vector(2, f64), b: @Vector(2, f64)) @Vector(2, f64) {
+    return compareMask(a, b, 2);
+}
+
+pub inline fn ia32_cmpleps(a: @Vector(4, f32), b: @Vector(4, f32)) @Vector(4, f32) {
+    return compareMask(a, b, 2);
+}
+
+pub inline fn ia32_cmpltpd(a: @Vector(2, f64), b: @Vector(2, f64)) @Vector(2, f64) {
+    return compareMask(a, b, 1);
+}
+
+pub inline fn ia32_cmpltps(a: @Vector(4, f32), b: @Vector(4, f32)) @Vector(4, f32) {
+    return compareMask(a, b, 1);
+}
+
+pub inline fn ia32_cmpneqpd(a: @Vector(2, f64), b: @Vector(2, f64)) @Vector(2, f64) {
+    return compareMask(a, b, 4);
+}
+
+pub inline fn ia32_cmpneqps(a: @Vector(4, f32), b: @Vector(4, f32)) @Vector(4, f32) {
+    return compareMask(a, b, 4);
+}
+
+pub inline fn ia32_cmpnlepd(a: @Vector(2, f64), b: @Vector(2, f64)) @Vector(2, f64) {
+    return compareMask(a, b, 6);
+}
+
+pub inline fn ia32_cmpnleps(a: @Vector(4, f32), b: @Vector(4, f32)) @Vector(4, f32) {
+    return compareMask(a, b, 6);
+}
+
+pub inline fn ia32_cmpnltpd(a: @Vector(2, f64), b: @Vector(2, f64)) @Vector(2, f64) {
+    return compareMask(a, b, 5);
+}
+
+pub inline fn ia32_cmpnltps(a: @Vector(4, f32), b: @Vector(4, f32)) @Vector(4, f32) {
+    return compareMask(a, b, 5);
+}
+
+pub inline fn ia32_cmpordpd(a: @Vector(2, f64), b: @Vector(2, f64)) @Vector(2, f64) {
+    return compareMask(a, b, 7);
+}
+
+pub inline fn ia32_cmpordps(a: @Vector(4, f32), b: @Vector(4, f32)) @Vector(4, f32) {
+    return compareMask(a, b, 7);
+}
+
+pub inline fn ia32_cmppd(a: @Vector(2, f64), b: @Vector(2, f64), comptime predicate: c_int) @Vector(2, f64) {
+    return compareMask(a, b, predicate);
+}
+
+pub inline fn ia32_cmppd256(a: @Vector(4, f64), b: @Vector(4, f64), comptime predicate: c_int) @Vector(4, f64) {
+    return compareMask(a, b, predicate);
+}
+
+pub inline fn ia32_cmpps(a: @Vector(4, f32), b: @Vector(4, f32), comptime predicate: c_int) @Vector(4, f32) {
+    return compareMask(a, b, predicate);
+}
+
+pub inline fn ia32_cmpps256(a: @Vector(8, f32), b: @Vector(8, f32), comptime predicate: c_int) @Vector(8, f32) {
+    return compareMask(a, b, predicate);
+}
+
+pub inline fn ia32_cmpunordpd(a: @Vector(2, f64), b: @Vector(2, f64)) @Vector(2, f64) {
+    return compareMask(a, b, 3);
+}
+
+pub inline fn ia32_cmpunordps(a: @Vector(4, f32), b: @Vector(4, f32)) @Vector(4, f32) {
+    return compareMask(a, b, 3);
+}
+
+pub inline fn ia32_cvttps2dq(a: @Vector(4, f32)) @Vector(4, c_int) {
+    return truncateToInt(a);
+}
+
+pub inline fn ia32_cvttps2dq256(a: @Vector(8, f32)) @Vector(8, c_int) {
+    return truncateToInt(a);
+}
+
+pub inline fn ia32_maxpd(a: @Vector(2, f64), b: @Vector(2, f64)) @Vector(2, f64) {
+    return @select(f64, a > b, a, b);
+}
+
+pub inline fn ia32_maxpd256(a: @Vector(4, f64), b: @Vector(4, f64)) @Vector(4, f64) {
+    return @select(f64, a > b, a, b);
+}
+
+/// Like the instruction, returns `b` when either element is NaN or both are zero.
+pub inline fn ia32_maxps(a: @Vector(4, f32), b: @Vector(4, f32)) @Vector(4, f32) {
+    return @select(f32, a > b, a, b);
+}
+
+pub inline fn ia32_maxps256(a: @Vector(8, f32), b: @Vector(8, f32)) @Vector(8, f32) {
+    return @select(f32, a > b, a, b);
+}
+
+pub inline fn ia32_minpd(a: @Vector(2, f64), b: @Vector(2, f64)) @Vector(2, f64) {
+    return @select(f64, a < b, a, b);
+}
+
+pub inline fn ia32_minpd256(a: @Vector(4, f64), b: @Vector(4, f64)) @Vector(4, f64) {
+    return @select(f64, a < b, a, b);
+}
+
+/// Like the instruction, returns `b` when either element is NaN or both are zero.
+pub inline fn ia32_minps(a: @Vector(4, f32), b: @Vector(4, f32)) @Vector(4, f32) {
+    return @select(f32, a < b, a, b);
+}
+
+pub inline fn ia32_minps256(a: @Vector(8, f32), b: @Vector(8, f32)) @Vector(8, f32) {
+    return @select(f32, a < b, a, b);
+}
+
+pub inline fn ia32_movmskpd(a: @Vector(2, f64)) c_int {
+    return signMask(a);
+}
+
+pub inline fn ia32_movmskpd256(a: @Vector(4, f64)) c_int {
+    return signMask(a);
+}
+
+pub inline fn ia32_movmskps(a: @Vector(4, f32)) c_int {
+    return signMask(a);
+}
+
+pub inline fn ia32_movmskps256(a: @Vector(8, f32)) c_int {
+    return signMask(a);
+}
+
+pub inline fn ia32_packssdw128(a: @Vector(4, c_int), b: @Vector(4, c_int)) @Vector(8, c_short) {
+    return packSaturate(@Vector(8, c_short), i16, a, b);
+}
+
+pub inline fn ia32_packsswb128(a: @Vector(8, c_short), b: @Vector(8, c_short)) @Vector(16, u8) {
+    return packSaturate(@Vector(16, u8), i8, a, b);
+}
+
+pub inline fn ia32_packuswb128(a: @Vector(8, c_short), b: @Vector(8, c_short)) @Vector(16, u8) {
+    return packSaturate(@Vector(16, u8), u8, a, b);
+}
+
+pub inline fn ia32_paddsb128(a: @Vector(16, u8), b: @Vector(16, u8)) @Vector(16, u8) {
+    const sa: @Vector(16, i8) = @bitCast(a);
+    const sb: @Vector(16, i8) = @bitCast(b);
+    return @bitCast(sa +| sb);
+}
+
+pub inline fn ia32_paddsw128(a: @Vector(8, c_short), b: @Vector(8, c_short)) @Vector(8, c_short) {
+    return a +| b;
+}
+
+pub inline fn ia32_paddusb128(a: @Vector(16, u8), b: @Vector(16, u8)) @Vector(16, u8) {
+    return a +| b;
+}
+
+pub inline fn ia32_paddusw128(a: @Vector(8, c_short), b: @Vector(8, c_short)) @Vector(8, c_short) {
+    const ua: @Vector(8, u16) = @bitCast(a);
+    const ub: @Vector(8, u16) = @bitCast(b);
+    return @bitCast(ua +| ub);
+}
+
+pub inline fn ia32_pause() void {
+    std.atomic.spinLoopHint();
+}
+
+pub inline fn ia32_pavgb128(a: @Vector(16, u8), b: @Vector(16, u8)) @Vector(16, u8) {
+    return roundedAverage(a, b);
+}
+
+pub inline fn ia32_pavgb256(a: @Vector(32, u8), b: @Vector(32, u8)) @Vector(32, u8) {
+    return roundedAverage(a, b);
+}
+
+pub inline fn ia32_pavgw128(a: @Vector(8, c_short), b: @Vector(8, c_short)) @Vector(8, c_short) {
+    return roundedAverage(a, b);
+}
+
+pub inline fn ia32_pavgw256(a: @Vector(16, c_short), b: @Vector(16, c_short)) @Vector(16, c_short) {
+    return roundedAverage(a, b);
+}
+
+pub inline fn ia32_pmaddwd128(a: @Vector(8, c_short), b: @Vector(8, c_short)) @Vector(4, c_int) {
+    return multiplyAddPairs(a, b);
+}
+
+pub inline fn ia32_pmaddwd256(a: @Vector(16, c_short), b: @Vector(16, c_short)) @Vector(8, c_int) {
+    return multiplyAddPairs(a, b);
+}
+
+pub inline fn ia32_pmaxsw128(a: @Vector(8, c_short), b: @Vector(8, c_short)) @Vector(8, c_short) {
+    return @max(a, b);
+}
+
+pub inline fn ia32_pmaxub128(a: @Vector(16, u8), b: @Vector(16, u8)) @Vector(16, u8) {
+    return @max(a, b);
+}
+
+pub inline fn ia32_pminsw128(a: @Vector(8, c_short), b: @Vector(8, c_short)) @Vector(8, c_short) {
+    return @min(a, b);
+}
+
+pub inline fn ia32_pminub128(a: @Vector(16, u8), b: @Vector(16, u8)) @Vector(16, u8) {
+    return @min(a, b);
+}
+
+pub inline fn ia32_pmovmskb128(a: @Vector(16, u8)) c_int {
+    return signMask(a);
+}
+
+pub inline fn ia32_pmovmskb256(a: @Vector(32, u8)) c_int {
+    return signMask(a);
+}
+
+pub inline fn ia32_pmulhuw128(a: @Vector(8, c_short), b: @Vector(8, c_short)) @Vector(8, c_short) {
+    return multiplyHigh(u16, a, b);
+}
+
+pub inline fn ia32_pmulhuw256(a: @Vector(16, c_short), b: @Vector(16, c_short)) @Vector(16, c_short) {
+    return multiplyHigh(u16, a, b);
+}
+
+pub inline fn ia32_pmulhw128(a: @Vector(8, c_short), b: @Vector(8, c_short)) @Vector(8, c_short) {
+    return multiplyHigh(i16, a, b);
+}
+
+pub inline fn ia32_pmulhw256(a: @Vector(16, c_short), b: @Vector(16, c_short)) @Vector(16, c_short) {
+    return multiplyHigh(i16, a, b);
+}
+
+pub inline fn ia32_pmuludq128(a: @Vector(4, c_int), b: @Vector(4, c_int)) @Vector(2, c_longlong) {
+    return multiplyEvenUnsigned(a, b);
+}
+
+pub inline fn ia32_pmuludq256(a: @Vector(8, c_int), b: @Vector(8, c_int)) @Vector(4, c_longlong) {
+    return multiplyEvenUnsigned(a, b);
+}
+
+pub inline fn ia32_psadbw128(a: @Vector(16, u8), b: @Vector(16, u8)) @Vector(2, c_longlong) {
+    return sumAbsoluteDifferences(a, b);
+}
+
+pub inline fn ia32_psadbw256(a: @Vector(32, u8), b: @Vector(32, u8)) @Vector(4, c_longlong) {
+    return sumAbsoluteDifferences(a, b);
+}
+
+pub inline fn ia32_pslldi128(a: @Vector(4, c_int), count: c_int) @Vector(4, c_int) {
+    return shiftLeftImm(a, count);
+}
+
+pub inline fn ia32_pslldi256(a: @Vector(8, c_int), count: c_int) @Vector(8, c_int) {
+    return shiftLeftImm(a, count);
+}
+
+pub inline fn ia32_psllqi128(a: @Vector(2, c_longlong), count: c_int) @Vector(2, c_longlong) {
+    return shiftLeftImm(a, count);
+}
+
+pub inline fn ia32_psllqi256(a: @Vector(4, c_longlong), count: c_int) @Vector(4, c_longlong) {
+    return shiftLeftImm(a, count);
+}
+
+pub inline fn ia32_psllwi128(a: @Vector(8, c_short), count: c_int) @Vector(8, c_short) {
+    return shiftLeftImm(a, count);
+}
+
+pub inline fn ia32_psllwi256(a: @Vector(16, c_short), count: c_int) @Vector(16, c_short) {
+    return shiftLeftImm(a, count);
+}
+
+pub inline fn ia32_psradi128(a: @Vector(4, c_int), count: c_int) @Vector(4, c_int) {
+    return shiftRightArithImm(a, count);
+}
+
+pub inline fn ia32_psradi256(a: @Vector(8, c_int), count: c_int) @Vector(8, c_int) {
+    return shiftRightArithImm(a, count);
+}
+
+pub inline fn ia32_psrawi128(a: @Vector(8, c_short), count: c_int) @Vector(8, c_short) {
+    return shiftRightArithImm(a, count);
+}
+
+pub inline fn ia32_psrawi256(a: @Vector(16, c_short), count: c_int) @Vector(16, c_short) {
+    return shiftRightArithImm(a, count);
+}
+
+pub inline fn ia32_psrldi128(a: @Vector(4, c_int), count: c_int) @Vector(4, c_int) {
+    return shiftRightLogicalImm(a, count);
+}
+
+pub inline fn ia32_psrldi256(a: @Vector(8, c_int), count: c_int) @Vector(8, c_int) {
+    return shiftRightLogicalImm(a, count);
+}
+
+pub inline fn ia32_psrlqi128(a: @Vector(2, c_longlong), count: c_int) @Vector(2, c_longlong) {
+    return shiftRightLogicalImm(a, count);
+}
+
+pub inline fn ia32_psrlqi256(a: @Vector(4, c_longlong), count: c_int) @Vector(4, c_longlong) {
+    return shiftRightLogicalImm(a, count);
+}
+
+pub inline fn ia32_psrlwi128(a: @Vector(8, c_short), count: c_int) @Vector(8, c_short) {
+    return shiftRightLogicalImm(a, count);
+}
+
+pub inline fn ia32_psrlwi256(a: @Vector(16, c_short), count: c_int) @Vector(16, c_short) {
+    return shiftRightLogicalImm(a, count);
+}
+
+pub inline fn ia32_psubsb128(a: @Vector(16, u8), b: @Vector(16, u8)) @Vector(16, u8) {
+    const sa: @Vector(16, i8) = @bitCast(a);
+    const sb: @Vector(16, i8) = @bitCast(b);
+    return @bitCast(sa -| sb);
+}
+
+pub inline fn ia32_psubsw128(a: @Vector(8, c_short), b: @Vector(8, c_short)) @Vector(8, c_short) {
+    return a -| b;
+}
+
+pub inline fn ia32_psubusb128(a: @Vector(16, u8), b: @Vector(16, u8)) @Vector(16, u8) {
+    return a -| b;
+}
+
+pub inline fn ia32_psubusw128(a: @Vector(8, c_short), b: @Vector(8, c_short)) @Vector(8, c_short) {
+    const ua: @Vector(8, u16) = @bitCast(a);
+    const ub: @Vector(8, u16) = @bitCast(b);
+    return @bitCast(ua -| ub);
+}
+
+/// Computed exactly rather than with the 12-bit approximation of the instruction.
+pub inline fn ia32_rcpps(a: @Vector(4, f32)) @Vector(4, f32) {
+    return @as(@Vector(4, f32), @splat(1)) / a;
+}
+
+pub inline fn ia32_rcpps256(a: @Vector(8, f32)) @Vector(8, f32) {
+    return @as(@Vector(8, f32), @splat(1)) / a;
+}
+
+/// Computed exactly rather than with the 12-bit approximation of the instruction.
+pub inline fn ia32_rsqrtps(a: @Vector(4, f32)) @Vector(4, f32) {
+    return @as(@Vector(4, f32), @splat(1)) / @sqrt(a);
+}
+
+pub inline fn ia32_rsqrtps256(a: @Vector(8, f32)) @Vector(8, f32) {
+    return @as(@Vector(8, f32), @splat(1)) / @sqrt(a);
+}
+
+pub inline fn ia32_sqrtpd(a: @Vector(2, f64)) @Vector(2, f64) {
+    return @sqrt(a);
+}
+
+pub inline fn ia32_sqrtpd256(a: @Vector(4, f64)) @Vector(4, f64) {
+    return @sqrt(a);
+}
+
+pub inline fn ia32_sqrtps(a: @Vector(4, f32)) @Vector(4, f32) {
+    return @sqrt(a);
+}
+
+pub inline fn ia32_sqrtps256(a: @Vector(8, f32)) @Vector(8, f32) {
+    return @sqrt(a);
+}
+
 pub inline fn inff() f32 {
     return std.math.inf(f32);
 }
@@ -156,6 +591,39 @@ pub inline fn log(val: f64) f64 {
     return @log(val);
 }
 
+/// Returns a pointer to the first of the first `len` bytes of `ptr` that is equal to `val`.
+pub fn memchr(ptr: ?*const anyopaque, val: c_int, len: usize) ?*anyopaque {
+    if (len == 0) return null;
+    const bytes: [*]const u8 = @ptrCast(ptr.?);
+    const byte: u8 = @truncate(@as(c_uint, @bitCast(val)));
+    const needle: ByteVector = @splat(byte);
+    var i: usize = 0;
+    while (len - i >= byte_vector_len) : (i += byte_vector_len) {
+        const chunk: ByteVector = bytes[i..][0..byte_vector_len].*;
+        if (std.simd.firstTrue(chunk == needle)) |index| return @ptrCast(@constCast(bytes + i + index));
+    }
+    while (i < len) : (i += 1) {
+        if (bytes[i] == byte) return @ptrCast(@constCast(bytes + i));
+    }
+    return null;
+}
+
+pub fn memcmp(ptr1: ?*const anyopaque, ptr2: ?*const anyopaque, len: usize) c_int {
+    if (len == 0) return 0;
+    const a: [*]const u8 = @ptrCast(ptr1.?);
+    const b: [*]const u8 = @ptrCast(ptr2.?);
+    var i: usize = 0;
+    while (len - i >= byte_vector_len) : (i += byte_vector_len) {
+        const a_chunk: ByteVector = a[i..][0..byte_vector_len].*;
+        const b_chunk: ByteVector = b[i..][0..byte_vector_len].*;
+        if (std.simd.firstTrue(a_chunk != b_chunk)) |index| return byteDifference(a[i + index], b[i + index]);
+    }
+    while (i < len) : (i += 1) {
+        if (a[i] != b[i]) return byteDifference(a[i], b[i]);
+    }
+    return 0;
+}
+
 pub inline fn memcpy_chk(
     noalias dst: ?*anyopaque,
     noalias src: ?*const anyopaque,
@@ -182,6 +650,28 @@ pub inline fn memcpy(
     return dst;
 }
 
+pub inline fn memmove_chk(
+    dst: ?*anyopaque,
+    src: ?*const anyopaque,
+    len: usize,
+    remaining: usize,
+) ?*anyopaque {
+    if (len > remaining) @panic("__builtin___memmove_chk called with len > remaining");
+    if (len > 0) @memmove(
+        @as([*]u8, @ptrCast(dst.?))[0..len],
+        @as([*]const u8, @ptrCast(src.?))[0..len],
+    );
+    return dst;
+}
+
+pub inline fn memmove(dst: ?*anyopaque, src: ?*const anyopaque, len: usize) ?*anyopaque {
+    if (len > 0) @memmove(
+        @as([*]u8, @ptrCast(dst.?))[0..len],
+        @as([*]const u8, @ptrCast(src.?))[0..len],
+    );
+    return dst;
+}
+
 pub inline fn memset_chk(
     dst: ?*anyopaque,
     val: c_int,
@@ -195,8 +685,10 @@ pub inline fn memset_chk(
 }
 
 pub inline fn memset(dst: ?*anyopaque, val: c_int, len: usize) ?*anyopaque {
-    const dst_cast = @as([*c]u8, @ptrCast(dst));
-    @memset(dst_cast[0..len], @as(u8, @bitCast(@as(i8, @truncate(val)))));
+    if (len > 0) @memset(
+        @as([*]u8, @ptrCast(dst.?))[0..len],
+        @as(u8, @bitCast(@as(i8, @truncate(val)))),
+    );
     return dst;
 }
 
@@ -206,6 +698,75 @@ pub fn mul_overflow(a: anytype, b: anytype, result: *@TypeOf(a, b)) c_int {
     return res[1];
 }
 
+pub inline fn neon_vabs_v(a: @Vector(8, i8), comptime flags: c_int) @Vector(8, i8) {
+    return neonUnary(.abs, a, flags);
+}
+
+pub inline fn neon_vabsq_v(a: @Vector(16, i8), comptime flags: c_int) @Vector(16, i8) {
+    return neonUnary(.abs, a, flags);
+}
+
+pub inline fn neon_vaddvq_f32(a: @Vector(4, f32)) f32 {
+    return @reduce(.Add, a);
+}
+
+pub inline fn neon_vaddvq_s32(a: @Vector(4, c_int)) c_int {
+    return @reduce(.Add, a);
+}
+
+pub inline fn neon_vaddvq_u32(a: @Vector(4, c_uint)) c_uint {
+    return @reduce(.Add, a);
+}
+
+/// The type flags do not matter for loads and stores, which copy the bytes as is.
+pub inline fn neon_vld1_v(ptr: ?*const anyopaque, comptime _: c_int) @Vector(8, i8) {
+    return @as(*align(1) const [8]i8, @ptrCast(ptr.?)).*;
+}
+
+pub inline fn neon_vld1q_v(ptr: ?*const anyopaque, comptime _: c_int) @Vector(16, i8) {
+    return @as(*align(1) const [16]i8, @ptrCast(ptr.?)).*;
+}
+
+pub inline fn neon_vmax_v(a: @Vector(8, i8), b: @Vector(8, i8), comptime flags: c_int) @Vector(8, i8) {
+    return neonBinary(.max, a, b, flags);
+}
+
+pub inline fn neon_vmaxq_v(a: @Vector(16, i8), b: @Vector(16, i8), comptime flags: c_int) @Vector(16, i8) {
+    return neonBinary(.max, a, b, flags);
+}
+
+pub inline fn neon_vmin_v(a: @Vector(8, i8), b: @Vector(8, i8), comptime flags: c_int) @Vector(8, i8) {
+    return neonBinary(.min, a, b, flags);
+}
+
+pub inline fn neon_vminq_v(a: @Vector(16, i8), b: @Vector(16, i8), comptime flags: c_int) @Vector(16, i8) {
+    return neonBinary(.min, a, b, flags);
+}
+
+pub inline fn neon_vqadd_v(a: @Vector(8, i8), b: @Vector(8, i8), comptime flags: c_int) @Vector(8, i8) {
+    return neonBinary(.add_sat, a, b, flags);
+}
+
+pub inline fn neon_vqaddq_v(a: @Vector(16, i8), b: @Vector(16, i8), comptime flags: c_int) @Vector(16, i8) {
+    return neonBinary(.add_sat, a, b, flags);
+}
+
+pub inline fn neon_vqsub_v(a: @Vector(8, i8), b: @Vector(8, i8), comptime flags: c_int) @Vector(8, i8) {
+    return neonBinary(.sub_sat, a, b, flags);
+}
+
+pub inline fn neon_vqsubq_v(a: @Vector(16, i8), b: @Vector(16, i8), comptime flags: c_int) @Vector(16, i8) {
+    return neonBinary(.sub_sat, a, b, flags);
+}
+
+pub inline fn neon_vst1_v(ptr: ?*anyopaque, val: @Vector(8, i8), comptime _: c_int) void {
+    @as(*align(1) [8]i8, @ptrCast(ptr.?)).* = val;
+}
+
+pub inline fn neon_vst1q_v(ptr: ?*anyopaque, val: @Vector(16, i8), comptime _: c_int) void {
+    @as(*align(1) [16]i8, @ptrCast(ptr.?)).* = val;
+}
+
 /// returns a quiet NaN. Quiet NaNs have many representations; tagp is used to select one in an
 /// implementation-defined way.
 /// This implementation is based on the description for nan provided in the GCC docs at
@@ -244,6 +805,54 @@ pub inline fn popcount(val: c_uint) c_int {
     return @as(c_int, @bitCast(@as(c_uint, @popCount(val))));
 }
 
+pub inline fn popcountl(val: c_ulong) c_int {
+    @setRuntimeSafety(false);
+    return @popCount(val);
+}
+
+pub inline fn popcountll(val: c_ulonglong) c_int {
+    @setRuntimeSafety(false);
+    return @popCount(val);
+}
+
+/// `rw` and `locality` must be compile time constants, as they are in C.
+/// The translator fills in the C defaults of 0 and 3 when they are omitted.
+pub inline fn prefetch(addr: ?*const anyopaque, comptime rw: c_int, comptime locality: c_int) void {
+    @prefetch(addr orelse return, .{
+        .rw = if (rw == 0) .read else .write,
+        .locality = locality,
+        .cache = .data,
+    });
+}
+
+pub inline fn reduce_add(vec: anytype) Scalar(@TypeOf(vec)) {
+    return @reduce(.Add, vec);
+}
+
+pub inline fn reduce_and(vec: anytype) Scalar(@TypeOf(vec)) {
+    return @reduce(.And, vec);
+}
+
+pub inline fn reduce_max(vec: anytype) Scalar(@TypeOf(vec)) {
+    return @reduce(.Max, vec);
+}
+
+pub inline fn reduce_min(vec: anytype) Scalar(@TypeOf(vec)) {
+    return @reduce(.Min, vec);
+}
+
+pub inline fn reduce_mul(vec: anytype) Scalar(@TypeOf(vec)) {
+    return @reduce(.Mul, vec);
+}
+
+pub inline fn reduce_or(vec: anytype) Scalar(@TypeOf(vec)) {
+    return @reduce(.Or, vec);
+}
+
+pub inline fn reduce_xor(vec: anytype) Scalar(@TypeOf(vec)) {
+    return @reduce(.Xor, vec);
+}
+
 pub inline fn roundf(val: f32) f32 {
     return @round(val);
 }
@@ -276,16 +885,41 @@ pub inline fn sqrt(val: f64) f64 {
     return @sqrt(val);
 }
 
-pub inline fn strcmp(s1: [*c]const u8, s2: [*c]const u8) c_int {
-    return switch (std.mem.orderZ(u8, s1, s2)) {
-        .lt => -1,
-        .eq => 0,
-        .gt => 1,
-    };
+pub fn strcmp(s1: [*c]const u8, s2: [*c]const u8) c_int {
+    // Comptime pointers have no address, so compare one byte at a time.
+    if (@inComptime()) {
+        var i: usize = 0;
+        while (s1[i] == s2[i] and s1[i] != 0) i += 1;
+        return byteDifference(s1[i], s2[i]);
+    }
+    const zeroes: ByteVector = @splat(0);
+    const ones: @Vector(byte_vector_len, bool) = @splat(true);
+    var i: usize = 0;
+    while (true) {
+        if (canLoadVector(s1 + i) and canLoadVector(s2 + i)) {
+            const a: ByteVector = s1[i..][0..byte_vector_len].*;
+            const b: ByteVector = s2[i..][0..byte_vector_len].*;
+            // Stop at the first difference or at the terminator of both strings.
+            const stop = @select(bool, a == b, a == zeroes, ones);
+            if (std.simd.firstTrue(stop)) |index| return byteDifference(s1[i + index], s2[i + index]);
+            i += byte_vector_len;
+        } else {
+            if (s1[i] != s2[i] or s1[i] == 0) return byteDifference(s1[i], s2[i]);
+            i += 1;
+        }
+    }
+}
+
+pub fn strlen(s: [*c]const u8) usize {
+    return std.mem.indexOfSentinel(u8, 0, @as([*:0]const u8, @ptrCast(s)));
 }
 
-pub inline fn strlen(s: [*c]const u8) usize {
-    return std.mem.sliceTo(s, 0).len;
+/// Subtracts `b` from `a` with infinite precision and stores the result in the type
+/// `result` points to. Returns true if the result does not fit, in which case the
+/// truncated value is stored.
+pub inline fn sub_overflow(a: anytype, b: anytype, result: anytype) bool {
+    const Wide = OverflowInt(@TypeOf(result.*), @TypeOf(a), @TypeOf(b));
+    return storeOverflow(@as(Wide, a) - @as(Wide, b), result);
 }
 
 pub inline fn truncf(val: f32) f32 {
@@ -299,3 +933,264 @@ pub inline fn trunc(val: f64) f64 {
 pub inline fn @"unreachable"() noreturn {
     unreachable;
 }
+
+/// Number of bytes compared at a time by the string and memory builtins.
+/// Without SIMD support this is a word.
+const byte_vector_len = std.simd.suggestVectorLength(u8) orelse @sizeOf(usize);
+const ByteVector = @Vector(byte_vector_len, u8);
+
+/// Returns true if `byte_vector_len` bytes can be loaded from `ptr` without crossing
+/// a page boundary. Loading bytes past the terminator of a string is then harmless
+/// since they are in the same page as the terminator. Only valid at runtime.
+inline fn canLoadVector(ptr: [*c]const u8) bool {
+    return @intFromPtr(ptr) % std.heap.page_size_min <= std.heap.page_size_min - byte_vector_len;
+}
+
+/// The sign of the result of comparing two bytes as `unsigned char` like C.
+inline fn byteDifference(a: u8, b: u8) c_int {
+    return @as(c_int, a) - @as(c_int, b);
+}
+
+/// A signed integer wide enough for every value of `T`, `A` and `B` and for their sum
+/// and difference. Integer literals are assumed to fit `T`.
+fn OverflowInt(comptime T: type, comptime A: type, comptime B: type) type {
+    var bits: u16 = @typeInfo(T).int.bits;
+    inline for (.{ A, B }) |Operand| {
+        if (Operand != comptime_int) bits = @max(bits, @typeInfo(Operand).int.bits);
+    }
+    return std.meta.Int(.signed, bits + 2);
+}
+
+/// Stores `wide` truncated to the type `result` points to and returns true if it did not fit.
+inline fn storeOverflow(wide: anytype, result: anytype) bool {
+    const T = @TypeOf(result.*);
+    const Unsigned = std.meta.Int(.unsigned, @bitSizeOf(@TypeOf(wide)));
+    const bits: std.meta.Int(.unsigned, @bitSizeOf(T)) = @truncate(@as(Unsigned, @bitCast(wide)));
+    result.* = @bitCast(bits);
+    return std.math.cast(T, wide) == null;
+}
+
+/// The element type of a vector, or `T` itself for scalars.
+fn Scalar(comptime T: type) type {
+    return switch (@typeInfo(T)) {
+        .vector => |info| info.child,
+        else => T,
+    };
+}
+
+/// `@Vector` of the same length as `V` with elements of type `Elem`.
+fn WithElem(comptime V: type, comptime Elem: type) type {
+    return @Vector(@typeInfo(V).vector.len, Elem);
+}
+
+/// Integer with the same bit size as the elements of `V`.
+fn ElemBits(comptime V: type, comptime signedness: std.builtin.Signedness) type {
+    return std.meta.Int(signedness, @bitSizeOf(Scalar(V)));
+}
+
+/// Implements the x86 floating point comparison predicates. Each result element has
+/// all bits set if the comparison holds and is zero otherwise.
+/// Signaling and quiet predicates are not distinguished.
+inline fn compareMask(a: anytype, b: @TypeOf(a), comptime predicate: c_int) @TypeOf(a) {
+    const V = @TypeOf(a);
+    const Mask = WithElem(V, ElemBits(V, .signed));
+    const zeroes: Mask = @splat(0);
+    const ones = ~zeroes;
+    const lt = @select(Scalar(Mask), a < b, ones, zeroes);
+    const eq = @select(Scalar(Mask), a == b, ones, zeroes);
+    const gt = @select(Scalar(Mask), a > b, ones, zeroes);
+    const unord = ~(lt | eq | gt);
+    const mask: Mask = switch (predicate & 0xf) {
+        0 => eq,
+        1 => lt,
+        2 => lt | eq,
+        3 => unord,
+        4 => ~eq,
+        5 => ~lt,
+        6 => ~(lt | eq),
+        7 => ~unord,
+        8 => eq | unord,
+        9 => lt | unord,
+        10 => lt | eq | unord,
+        11 => zeroes,
+        12 => lt | gt,
+        13 => gt | eq,
+        14 => gt,
+        15 => ones,
+        else => unreachable,
+    };
+    return @bitCast(mask);
+}
+
+/// Converts with truncation. Out of range and NaN elements produce the most negative integer.
+inline fn truncateToInt(a: anytype) WithElem(@TypeOf(a), c_int) {
+    const V = @TypeOf(a);
+    const min: V = @splat(-0x1p31);
+    const max: V = @splat(0x1p31);
+    const in_range = @select(Scalar(V), a < max, a, min);
+    return @intFromFloat(@select(Scalar(V), a >= min, in_range, min));
+}
+
+/// Collects the sign bit of each element into the low bits of the result.
+inline fn signMask(a: anytype) c_int {
+    const V = @TypeOf(a);
+    const Int = WithElem(V, ElemBits(V, .signed));
+    const ints: Int = @bitCast(a);
+    const Bits = WithElem(V, u1);
+    const negative = @select(u1, ints < @as(Int, @splat(0)), @as(Bits, @splat(1)), @as(Bits, @splat(0)));
+    const bits: std.meta.Int(.unsigned, @typeInfo(V).vector.len) = @bitCast(negative);
+    return @bitCast(@as(c_uint, bits));
+}
+
+/// Concatenates `a` and `b` and narrows each element to `Narrow` with saturation.
+inline fn packSaturate(comptime Result: type, comptime Narrow: type, a: anytype, b: @TypeOf(a)) Result {
+    const Joined = @Vector(2 * @typeInfo(@TypeOf(a)).vector.len, Scalar(@TypeOf(a)));
+    const joined: Joined = std.simd.join(a, b);
+    const min: Joined = @splat(std.math.minInt(Narrow));
+    const max: Joined = @splat(std.math.maxInt(Narrow));
+    const narrowed: WithElem(Joined, Narrow) = @intCast(@min(@max(joined, min), max));
+    return @bitCast(narrowed);
+}
+
+/// Unsigned average of each pair of elements, rounded up.
+inline fn roundedAverage(a: anytype, b: @TypeOf(a)) @TypeOf(a) {
+    const V = @TypeOf(a);
+    const Unsigned = WithElem(V, ElemBits(V, .unsigned));
+    const Wide = WithElem(V, std.meta.Int(.unsigned, @bitSizeOf(Scalar(V)) + 1));
+    const wide_a: Wide = @intCast(@as(Unsigned, @bitCast(a)));
+    const wide_b: Wide = @intCast(@as(Unsigned, @bitCast(b)));
+    const sum = wide_a + wide_b + @as(Wide, @splat(1));
+    const avg: Unsigned = @intCast(sum >> @splat(1));
+    return @bitCast(avg);
+}
+
+/// Multiplies 16-bit elements into 32-bit products and adds adjacent pairs.
+inline fn multiplyAddPairs(a: anytype, b: @TypeOf(a)) @Vector(@typeInfo(@TypeOf(a)).vector.len / 2, c_int) {
+    const len = @typeInfo(@TypeOf(a)).vector.len;
+    const Wide = @Vector(len, c_int);
+    const wide_a: Wide = @intCast(a);
+    const wide_b: Wide = @intCast(b);
+    const products = wide_a * wide_b;
+    const even, const odd = comptime masks: {
+        var even: [len / 2]i32 = undefined;
+        var odd: [len / 2]i32 = undefined;
+        for (0..len / 2) |i| {
+            even[i] = @intCast(2 * i);
+            odd[i] = @intCast(2 * i + 1);
+        }
+        break :masks .{ even, odd };
+    };
+    const lo = @shuffle(c_int, products, undefined, even);
+    const hi = @shuffle(c_int, products, undefined, odd);
+    return lo +% hi;
+}
+
+/// High half of the product of each pair of 16-bit elements.
+inline fn multiplyHigh(comptime Half: type, a: anytype, b: @TypeOf(a)) @TypeOf(a) {
+    const V = @TypeOf(a);
+    const Wide = WithElem(V, std.meta.Int(@typeInfo(Half).int.signedness, 2 * @bitSizeOf(Half)));
+    const wide_a: Wide = @intCast(@as(WithElem(V, Half), @bitCast(a)));
+    const wide_b: Wide = @intCast(@as(WithElem(V, Half), @bitCast(b)));
+    const high: WithElem(V, Half) = @truncate((wide_a * wide_b) >> @splat(@bitSizeOf(Half)));
+    return @bitCast(high);
+}
+
+/// Multiplies the even unsigned 32-bit elements into 64-bit products.
+inline fn multiplyEvenUnsigned(a: anytype, b: @TypeOf(a)) @Vector(@typeInfo(@TypeOf(a)).vector.len / 2, c_longlong) {
+    const len = @typeInfo(@TypeOf(a)).vector.len;
+    const even = comptime masks: {
+        var even: [len / 2]i32 = undefined;
+        for (&even, 0..) |*index, i| index.* = @intCast(2 * i);
+        break :masks even;
+    };
+    const Wide = @Vector(len / 2, u64);
+    const wide_a: Wide = @intCast(@shuffle(u32, @as(@Vector(len, u32), @bitCast(a)), undefined, even));
+    const wide_b: Wide = @intCast(@shuffle(u32, @as(@Vector(len, u32), @bitCast(b)), undefined, even));
+    return @bitCast(wide_a * wide_b);
+}
+
+/// Sums the absolute differences of each group of 8 unsigned bytes.
+inline fn sumAbsoluteDifferences(a: anytype, b: @TypeOf(a)) @Vector(@typeInfo(@TypeOf(a)).vector.len / 8, c_longlong) {
+    const len = @typeInfo(@TypeOf(a)).vector.len;
+    const diff: @Vector(len, u16) = @intCast(@max(a, b) - @min(a, b));
+    var result: @Vector(len / 8, c_longlong) = undefined;
+    inline for (0..len / 8) |group| {
+        const bytes: @Vector(8, u16) = std.simd.extract(diff, group * 8, 8);
+        result[group] = @reduce(.Add, bytes);
+    }
+    return result;
+}
+
+/// Shifts every element left by `count`. Counts of at least the element width produce zero.
+inline fn shiftLeftImm(a: anytype, count: c_int) @TypeOf(a) {
+    const V = @TypeOf(a);
+    const bits = @bitSizeOf(Scalar(V));
+    const unsigned_count: c_uint = @bitCast(count);
+    if (unsigned_count >= bits) return @splat(0);
+    const shift: std.math.Log2Int(Scalar(V)) = @intCast(unsigned_count);
+    return a << @splat(shift);
+}
+
+/// Shifts every element right, shifting in zeroes. Counts of at least the element width produce zero.
+inline fn shiftRightLogicalImm(a: anytype, count: c_int) @TypeOf(a) {
+    const V = @TypeOf(a);
+    const Unsigned = WithElem(V, ElemBits(V, .unsigned));
+    const bits = @bitSizeOf(Scalar(V));
+    const unsigned_count: c_uint = @bitCast(count);
+    if (unsigned_count >= bits) return @splat(0);
+    const shift: std.math.Log2Int(Scalar(Unsigned)) = @intCast(unsigned_count);
+    return @bitCast(@as(Unsigned, @bitCast(a)) >> @splat(shift));
+}
+
+/// Shifts every element right, shifting in the sign bit. Counts of at least the element
+/// width fill the element with its sign bit.
+inline fn shiftRightArithImm(a: anytype, count: c_int) @TypeOf(a) {
+    const V = @TypeOf(a);
+    const Signed = WithElem(V, ElemBits(V, .signed));
+    const bits = @bitSizeOf(Scalar(V));
+    const unsigned_count: c_uint = @bitCast(count);
+    const shift: std.math.Log2Int(Scalar(Signed)) = @intCast(@min(unsigned_count, bits - 1));
+    return @bitCast(@as(Signed, @bitCast(a)) >> @splat(shift));
+}
+
+/// The vector type described by the type flags argument of the `arm_neon.h` builtins,
+/// which pass every vector as a byte vector of the same size.
+fn NeonVector(comptime Bytes: type, comptime flags: c_int) type {
+    const unsigned = flags & 0x10 != 0;
+    const Elem = switch (flags & 0xf) {
+        0 => if (unsigned) u8 else i8,
+        1 => if (unsigned) u16 else i16,
+        2 => if (unsigned) u32 else i32,
+        3 => if (unsigned) u64 else i64,
+        4 => u8, // poly8
+        5 => u16, // poly16
+        6 => u64, // poly64
+        8 => f16,
+        9 => f32,
+        10 => f64,
+        else => @compileError("unsupported NEON type flags"),
+    };
+    return @Vector(@sizeOf(Bytes) / @sizeOf(Elem), Elem);
+}
+
+inline fn neonUnary(comptime op: enum { abs }, a: anytype, comptime flags: c_int) @TypeOf(a) {
+    const V = NeonVector(@TypeOf(a), flags);
+    const val: V = @bitCast(a);
+    const res: V = switch (op) {
+        .abs => elementwise_abs(val),
+    };
+    return @bitCast(res);
+}
+
+inline fn neonBinary(comptime op: enum { max, min, add_sat, sub_sat }, a: anytype, b: @TypeOf(a), comptime flags: c_int) @TypeOf(a) {
+    const V = NeonVector(@TypeOf(a), flags);
+    const lhs: V = @bitCast(a);
+    const rhs: V = @bitCast(b);
+    const res: V = switch (op) {
+        .max => @max(lhs, rhs),
+        .min => @min(lhs, rhs),
+        .add_sat => lhs +| rhs,
+        .sub_sat => lhs -| rhs,
+    };
+    return @bitCast(res);
+}
@@ -143,6 +143,20 @@ pub fn shuffleVectorIndex(comptime this_index: c_int, comptime source_vector_len
     return ~@as(i32, @intCast(b_index));
 }
 
+/// Convert the result of a Zig vector comparison to the C representation
+/// where each true element is -1 (all bits set) and each false element is 0.
+pub fn vectorMask(comptime VectorType: type, result: anytype) VectorType {
+    const Elem = @typeInfo(VectorType).vector.child;
+    const zeroes: VectorType = @splat(0);
+    return @select(Elem, result, ~zeroes, zeroes);
+}
+
+/// Convert a signed integer to `usize` for indexing and pointer arithmetic.
+/// Negative values wrap around, which results in the same address as in C.
+pub inline fn signedOffset(offset: anytype) usize {
+    return @bitCast(@as(isize, @intCast(offset)));
+}
+
 /// C `%` operator for signed integers
 /// C standard states: "If the quotient a/b is representable, the expression (a/b)*b + a%b shall equal a"
 /// The quotient is not representable if denominator is zero, or if numerator is the minimum integer for
@@ -154,6 +168,46 @@ pub fn signedRemainder(numerator: anytype, denominator: anytype) @TypeOf(numerat
     return numerator - @divTrunc(numerator, denominator) * denominator;
 }
 
+/// Storage representation of C's `__bf16`. Zig has no bfloat16 type, so values are
+/// converted to and from `f32` around each operation.
+pub const BFloat16 = enum(u16) { _ };
+
+/// Convert a `__bf16` to the float type `T`. This is exact for `f32` and wider types.
+pub fn bf16ToFloat(comptime T: type, value: BFloat16) T {
+    const bits = @as(u32, @intFromEnum(value)) << 16;
+    return @floatCast(@as(f32, @bitCast(bits)));
+}
+
+/// Convert an integer or float to `__bf16`, rounding to nearest even.
+pub fn floatToBf16(value: anytype) BFloat16 {
+    const Source = @TypeOf(value);
+    // A type in which `value` is exact.
+    const Wide = switch (@typeInfo(Source)) {
+        .float => Source,
+        .int => |info| if (info.bits <= 24) f32 else if (info.bits <= 53) f64 else f128,
+        .comptime_int, .comptime_float => f128,
+        else => @compileError("cannot convert " ++ @typeName(Source) ++ " to __bf16"),
+    };
+    const wide: Wide = switch (@typeInfo(Source)) {
+        .int, .comptime_int => @floatFromInt(value),
+        else => value,
+    };
+    const f: f32 = @floatCast(wide);
+    var bits: u32 = @bitCast(f);
+    if (std.math.isNan(f)) {
+        // Keep the sign and make sure the truncated payload stays a quiet NaN.
+        return @enumFromInt(@as(u16, @truncate(bits >> 16)) | 0x40);
+    }
+    // Rounding to nearest `f32` first could round a second time below. Rounding
+    // an inexact value to the odd neighbour instead keeps it on the correct side
+    // of the halfway point between two `__bf16` values.
+    if (@bitSizeOf(Wide) > 32 and @as(Wide, f) != wide and bits & 1 == 0) {
+        if (@abs(@as(Wide, f)) > @abs(wide)) bits -= 1 else bits += 1;
+    }
+    const rounding_bias = 0x7fff + ((bits >> 16) & 1);
+    return @enumFromInt(@as(u16, @truncate((bits + rounding_bias) >> 16)));
+}
+
 /// Given a type and value, cast the value to the type as c would.
 pub fn cast(comptime DestType: type, target: anytype) DestType {
     // this function should behave like transCCast in translate-c, except it's for macros
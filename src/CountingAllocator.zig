@@ -0,0 +1,120 @@
+//! Wraps an allocator and counts the bytes allocated through it, attributed to
+//! the subsystem that each view returned by `allocator` was created for.
+const std = @import("std");
+const mem = std.mem;
+const Alignment = mem.Alignment;
+
+const CountingAllocator = @This();
+
+pub const Subsystem = enum {
+    /// `Translator.gpa`: name and type tables, scope lists and temporary buffers.
+    translator,
+    /// `Translator.arena`: AST payloads and generated names.
+    arena,
+    /// The `ast.render` context and the rendered `std.zig.Ast`.
+    render,
+};
+
+pub const Counter = struct {
+    /// Bytes currently allocated.
+    current: usize = 0,
+    /// Highest value of `current`.
+    peak: usize = 0,
+    /// Bytes allocated over the lifetime of the allocator, including resizes.
+    total: usize = 0,
+    /// Number of successful allocations.
+    allocations: usize = 0,
+
+    fn grow(c: *Counter, len: usize) void {
+        c.current += len;
+        c.total += len;
+        c.peak = @max(c.peak, c.current);
+    }
+
+    fn shrink(c: *Counter, len: usize) void {
+        c.current -|= len;
+    }
+};
+
+const View = struct {
+    parent: *CountingAllocator,
+    subsystem: Subsystem,
+};
+
+child: mem.Allocator,
+counters: std.EnumArray(Subsystem, Counter) = .initFill(.{}),
+views: std.EnumArray(Subsystem, View) = undefined,
+
+pub fn init(child: mem.Allocator) CountingAllocator {
+    return .{ .child = child };
+}
+
+pub fn allocator(ca: *CountingAllocator, subsystem: Subsystem) mem.Allocator {
+    const view = ca.views.getPtr(subsystem);
+    view.* = .{ .parent = ca, .subsystem = subsystem };
+    return .{
+        .ptr = view,
+        .vtable = &.{
+            .alloc = alloc,
+            .resize = resize,
+            .remap = remap,
+            .free = free,
+        },
+    };
+}
+
+fn counter(view: *View) *Counter {
+    return view.parent.counters.getPtr(view.subsystem);
+}
+
+fn alloc(ctx: *anyopaque, len: usize, alignment: Alignment, ret_addr: usize) ?[*]u8 {
+    const view: *View = @ptrCast(@alignCast(ctx));
+    const ptr = view.parent.child.rawAlloc(len, alignment, ret_addr) orelse return null;
+    const c = counter(view);
+    c.grow(len);
+    c.allocations += 1;
+    return ptr;
+}
+
+fn resize(ctx: *anyopaque, memory: []u8, alignment: Alignment, new_len: usize, ret_addr: usize) bool {
+    const view: *View = @ptrCast(@alignCast(ctx));
+    if (!view.parent.child.rawResize(memory, alignment, new_len, ret_addr)) return false;
+    resized(counter(view), memory.len, new_len);
+    return true;
+}
+
+fn remap(ctx: *anyopaque, memory: []u8, alignment: Alignment, new_len: usize, ret_addr: usize) ?[*]u8 {
+    const view: *View = @ptrCast(@alignCast(ctx));
+    const ptr = view.parent.child.rawRemap(memory, alignment, new_len, ret_addr) orelse return null;
+    resized(counter(view), memory.len, new_len);
+    return ptr;
+}
+
+fn free(ctx: *anyopaque, memory: []u8, alignment: Alignment, ret_addr: usize) void {
+    const view: *View = @ptrCast(@alignCast(ctx));
+    view.parent.child.rawFree(memory, alignment, ret_addr);
+    counter(view).shrink(memory.len);
+}
+
+fn resized(c: *Counter, old_len: usize, new_len: usize) void {
+    if (new_len > old_len) c.grow(new_len - old_len) else c.shrink(old_len - new_len);
+}
+
+test CountingAllocator {
+    var counting: CountingAllocator = .init(std.testing.allocator);
+    const gpa = counting.allocator(.translator);
+    const arena = counting.allocator(.arena);
+
+    const a = try gpa.alloc(u8, 100);
+    const b = try arena.alloc(u8, 30);
+    try std.testing.expectEqual(100, counting.counters.get(.translator).current);
+    try std.testing.expectEqual(30, counting.counters.get(.arena).current);
+
+    gpa.free(a);
+    arena.free(b);
+    const translator = counting.counters.get(.translator);
+    try std.testing.expectEqual(0, translator.current);
+    try std.testing.expectEqual(100, translator.peak);
+    try std.testing.expectEqual(1, translator.allocations);
+    try std.testing.expectEqual(0, counting.counters.get(.render).total);
+}
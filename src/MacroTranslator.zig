@@ -55,7 +55,7 @@ fn expect(mt: *MacroTranslator, expected_id: CToken.Id) ParseError!void {
 }
 
 fn fail(mt: *MacroTranslator, comptime fmt: []const u8, args: anytype) !void {
-    return mt.t.failDeclExtra(&mt.t.global_scope.base, mt.macro.loc, mt.name, fmt, args);
+    return mt.t.failMacro(mt.macro.loc, mt.name, fmt, args);
 }
 
 fn tokSlice(mt: *const MacroTranslator) []const u8 {
@@ -343,8 +343,21 @@ fn parseCNumLit(mt: *MacroTranslator) ParseError!ZigNode {
         return error.ParseError;
     }
     if (suffix.isBitInt()) {
-        try mt.fail("TODO: _BitInt literals", .{});
-        return error.ParseError;
+        // The type of a bit-precise literal is the narrowest _BitInt that can represent it.
+        const value = std.fmt.parseInt(u128, bytes.items, 0) catch {
+            try mt.fail("TODO: _BitInt literals wider than 128 bits", .{});
+            return error.ParseError;
+        };
+        const is_unsigned = mem.indexOfAny(u8, suffix_str, "uU") != null;
+        const value_bits: u16 = 128 - @clz(value);
+        const type_name = if (is_unsigned)
+            try std.fmt.allocPrint(arena, "u{d}", .{@max(value_bits, 1)})
+        else
+            try std.fmt.allocPrint(arena, "i{d}", .{@max(value_bits + 1, 2)});
+        return ZigTag.as.create(arena, .{
+            .lhs = try ZigTag.type.create(arena, type_name),
+            .rhs = try ZigTag.integer_literal.create(arena, bytes.items),
+        });
     }
 
     if (is_float) {
@@ -900,6 +913,7 @@ fn parseCCastExpr(mt: *MacroTranslator, scope: *Scope) ParseError!ZigNode {
                 return mt.parseCPostfixExpr(scope, type_name);
             }
             const node_to_cast = try mt.parseCCastExpr(scope);
+            if (try mt.transConstantCast(type_name, node_to_cast)) |casted| return casted;
             return mt.t.createHelperCallNode(.cast, &.{ type_name, node_to_cast });
         }
         mt.i -= 1; // l_paren
@@ -907,6 +921,114 @@ fn parseCCastExpr(mt: *MacroTranslator, scope: *Scope) ParseError!ZigNode {
     return mt.parseCUnaryExpr(scope);
 }
 
+/// Casts of integer constants to integer or pointer types named directly in
+/// the macro body are resolved here so that the output does not go through
+/// `__helpers.cast`. Returns null if the cast depends on anything that is not
+/// known until the macro is used.
+fn transConstantCast(mt: *MacroTranslator, type_name: ZigNode, operand: ZigNode) !?ZigNode {
+    const arena = mt.t.arena;
+    const value = constantIntValue(operand) orelse return null;
+
+    if (type_name.castTag(.type)) |dest| {
+        const info = mt.intTypeInfo(dest.data) orelse return null;
+        const wrapped = wrapInt(value, info.bits, info.signedness);
+        return try ZigTag.as.create(arena, .{ .lhs = type_name, .rhs = try mt.createIntNode(wrapped) });
+    }
+
+    const elem_type = if (type_name.castTag(.c_pointer)) |ptr|
+        ptr.data.elem_type
+    else if (type_name.castTag(.optional_type)) |opt| blk: {
+        const ptr = opt.data.castTag(.single_pointer) orelse return null;
+        break :blk ptr.data.elem_type;
+    } else return null;
+
+    if (value == 0) {
+        return try ZigTag.as.create(arena, .{ .lhs = type_name, .rhs = ZigTag.null_literal.init() });
+    }
+
+    // A constant address must be suitably aligned for the pointee, which is
+    // only guaranteed for byte sized pointees.
+    const elem = elem_type.castTag(.type) orelse return null;
+    if (!mem.eql(u8, elem.data, "anyopaque") and !mem.eql(u8, elem.data, "u8") and !mem.eql(u8, elem.data, "i8")) return null;
+
+    // Addresses which do not fit a pointer wrap at the pointer width of the
+    // target, so `((void *)-1)` is left to `__helpers.cast`.
+    if (value < 0 or value > std.math.maxInt(u64) >> @intCast(64 - mt.t.comp.target.ptrBitWidth())) return null;
+    const ptr_from_int = try ZigTag.ptr_from_int.create(arena, try mt.createIntNode(value));
+    return try ZigTag.as.create(arena, .{ .lhs = type_name, .rhs = ptr_from_int });
+}
+
+/// Returns the value of an integer literal produced by `parseCNumLit`,
+/// optionally negated.
+fn constantIntValue(node: ZigNode) ?i128 {
+    if (node.castTag(.negate)) |negate| {
+        const as = negate.data.castTag(.as) orelse return null;
+        const ty = as.data.lhs.castTag(.type) orelse return null;
+        // Negating an unsigned literal wraps at the width of its type.
+        if (mem.startsWith(u8, ty.data, "c_u")) return null;
+        return -(constantIntValue(negate.data) orelse return null);
+    }
+    const as = node.castTag(.as) orelse return null;
+    const ty = as.data.lhs.castTag(.type) orelse return null;
+    const literal = as.data.rhs.castTag(.integer_literal) orelse return null;
+    for ([_][]const u8{ "c_int", "c_uint", "c_long", "c_ulong", "c_longlong", "c_ulonglong" }) |name| {
+        if (mem.eql(u8, ty.data, name)) break;
+    } else return null;
+    return std.fmt.parseInt(i128, literal.data, 0) catch null;
+}
+
+const IntTypeInfo = struct { bits: u16, signedness: std.builtin.Signedness };
+
+fn intTypeInfo(mt: *MacroTranslator, name: []const u8) ?IntTypeInfo {
+    const target = &mt.t.comp.target;
+    const c_types = [_]struct { []const u8, std.Target.CType, std.builtin.Signedness }{
+        .{ "c_short", .short, .signed },
+        .{ "c_ushort", .ushort, .unsigned },
+        .{ "c_int", .int, .signed },
+        .{ "c_uint", .uint, .unsigned },
+        .{ "c_long", .long, .signed },
+        .{ "c_ulong", .ulong, .unsigned },
+        .{ "c_longlong", .longlong, .signed },
+        .{ "c_ulonglong", .ulonglong, .unsigned },
+    };
+    for (c_types) |c_type| {
+        if (mem.eql(u8, name, c_type[0])) return .{ .bits = target.cTypeBitSize(c_type[1]), .signedness = c_type[2] };
+    }
+    if (mem.eql(u8, name, "usize")) return .{ .bits = target.ptrBitWidth(), .signedness = .unsigned };
+    if (mem.eql(u8, name, "isize")) return .{ .bits = target.ptrBitWidth(), .signedness = .signed };
+    if (name.len < 2 or (name[0] != 'u' and name[0] != 'i')) return null;
+    const bits = std.fmt.parseInt(u16, name[1..], 10) catch return null;
+    if (bits == 0 or bits > 64) return null;
+    return .{ .bits = bits, .signedness = if (name[0] == 'u') .unsigned else .signed };
+}
+
+/// Truncates `value` to `bits` bits and reinterprets it with the given
+/// signedness, like a C conversion to an integer type of that width.
+fn wrapInt(value: i128, bits: u16, signedness: std.builtin.Signedness) i128 {
+    const modulus = @as(i128, 1) << @intCast(bits);
+    const unsigned = @mod(value, modulus);
+    if (signedness == .signed and unsigned >= @divExact(modulus, 2)) return unsigned - modulus;
+    return unsigned;
+}
+
+fn createIntNode(mt: *MacroTranslator, value: i128) !ZigNode {
+    const arena = mt.t.arena;
+    const literal = try ZigTag.integer_literal.create(arena, try std.fmt.allocPrint(arena, "{d}", .{@abs(value)}));
+    if (value < 0) return ZigTag.negate.create(arena, literal);
+    return literal;
+}
+
+/// Types for which `@sizeOf` gives the same result as C's sizeof, allowing
+/// `__helpers.sizeof` to be skipped.
+fn hasStaticSize(type_name: ZigNode) bool {
+    if (type_name.castTag(.type)) |ty| return !mem.eql(u8, ty.data, "anyopaque");
+    return switch (type_name.tag()) {
+        .c_pointer => true,
+        .optional_type => type_name.castTag(.optional_type).?.data.tag() == .single_pointer,
+        else => false,
+    };
+}
+
 // allow_fail is set when unsure if we are parsing a type-name
 fn parseCTypeName(mt: *MacroTranslator, scope: *Scope) ParseError!?ZigNode {
     if (try mt.parseCSpecifierQualifierList(scope)) |node| {
@@ -1076,10 +1198,8 @@ fn parseCNumericType(mt: *MacroTranslator) ParseError!ZigNode {
     if (kw.eql(.{ .double = 1 }))
         return ZigTag.type.create(mt.t.arena, "f64");
 
-    if (kw.eql(.{ .long = 1, .double = 1 })) {
-        try mt.fail("unable to translate: TODO long double", .{});
-        return error.ParseError;
-    }
+    if (kw.eql(.{ .long = 1, .double = 1 }))
+        return ZigTag.type.create(mt.t.arena, "c_longdouble");
 
     if (kw.eql(.{ .float = 1, .complex = 1 })) {
         try mt.fail("unable to translate: TODO _Complex", .{});
@@ -1328,7 +1448,17 @@ fn parseCUnaryExpr(mt: *MacroTranslator, scope: *Scope) ParseError!ZigNode {
         .keyword_sizeof => {
             mt.i += 1;
             const operand = if (mt.eat(.l_paren)) blk: {
-                const inner = (try mt.parseCTypeName(scope)) orelse try mt.parseCUnaryExpr(scope);
+                if (try mt.parseCTypeName(scope)) |type_name| {
+                    try mt.expect(.r_paren);
+                    if (hasStaticSize(type_name)) {
+                        return ZigTag.as.create(mt.t.arena, .{
+                            .lhs = try ZigTag.type.create(mt.t.arena, "usize"),
+                            .rhs = try ZigTag.sizeof.create(mt.t.arena, type_name),
+                        });
+                    }
+                    break :blk type_name;
+                }
+                const inner = try mt.parseCUnaryExpr(scope);
                 try mt.expect(.r_paren);
                 break :blk inner;
             } else try mt.parseCUnaryExpr(scope);
@@ -0,0 +1,200 @@
+//! Records how long each phase of a translation takes, along with the time
+//! spent on every top level declaration, function and macro. Used by
+//! `-ftime-report` and `--trace-out`.
+const std = @import("std");
+const builtin = @import("builtin");
+const mem = std.mem;
+
+const aro = @import("aro");
+
+const CountingAllocator = @import("CountingAllocator.zig");
+
+const Profiler = @This();
+
+pub const Phase = enum {
+    toolchain,
+    preprocess,
+    parse,
+    prepopulate_names,
+    translate_decls,
+    translate_macros,
+    container_member_fns,
+    build_ast,
+    render,
+    write_output,
+};
+
+pub const PhaseStats = struct {
+    ran: bool = false,
+    /// Timestamp relative to the creation of the profiler, in nanoseconds.
+    start: u64 = 0,
+    /// Wall time spent in the phase, in nanoseconds.
+    duration: u64 = 0,
+    /// Peak resident set size of the process at the end of the phase.
+    peak_rss: usize = 0,
+    /// Bytes held by the translator arena at the end of the phase.
+    arena_bytes: usize = 0,
+};
+
+pub const Item = struct {
+    kind: Kind,
+    name: []const u8,
+    loc: aro.Source.Location,
+    /// Timestamp relative to the creation of the profiler, in nanoseconds.
+    start: u64,
+    duration: u64,
+
+    pub const Kind = enum { decl, function, macro };
+};
+
+gpa: mem.Allocator,
+timer: std.time.Timer,
+phases: std.EnumArray(Phase, PhaseStats) = .initFill(.{}),
+phase_start: u64 = 0,
+items: std.ArrayList(Item) = .empty,
+/// The arena whose usage is reported for each phase, if any.
+arena: ?*const std.heap.ArenaAllocator = null,
+
+pub fn init(gpa: mem.Allocator) error{TimerUnsupported}!Profiler {
+    return .{ .gpa = gpa, .timer = try .start() };
+}
+
+pub fn deinit(p: *Profiler) void {
+    p.items.deinit(p.gpa);
+}
+
+/// Nanoseconds elapsed since the profiler was created.
+pub fn now(p: *Profiler) u64 {
+    return p.timer.read();
+}
+
+pub fn beginPhase(p: *Profiler) void {
+    p.phase_start = p.now();
+}
+
+pub fn endPhase(p: *Profiler, phase: Phase) void {
+    const stats = p.phases.getPtr(phase);
+    if (!stats.ran) stats.start = p.phase_start;
+    stats.ran = true;
+    stats.duration += p.now() - p.phase_start;
+    stats.peak_rss = peakRss();
+    stats.arena_bytes = if (p.arena) |arena| arena.queryCapacity() else 0;
+}
+
+pub fn addItem(p: *Profiler, kind: Item.Kind, name: []const u8, loc: aro.Source.Location, start: u64) !void {
+    try p.items.append(p.gpa, .{
+        .kind = kind,
+        .name = name,
+        .loc = loc,
+        .start = start,
+        .duration = p.now() - start,
+    });
+}
+
+/// Prints the phase table, the allocation counters of each subsystem if `memory`
+/// is given and the `top` slowest declarations and macros.
+pub fn writeReport(p: *Profiler, comp: *aro.Compilation, memory: ?*const CountingAllocator, w: *std.Io.Writer, top: usize) !void {
+    try w.print("{s:<22} {s:>12} {s:>12} {s:>12}\n", .{ "phase", "wall", "peak rss", "arena" });
+    var total: u64 = 0;
+    for (std.enums.values(Phase)) |phase| {
+        const stats = p.phases.get(phase);
+        if (!stats.ran) continue;
+        total += stats.duration;
+        try w.print("{s:<22} {d:>9.3} ms {d:>8} KiB {d:>8} KiB\n", .{
+            @tagName(phase),
+            nsToMs(stats.duration),
+            stats.peak_rss / 1024,
+            stats.arena_bytes / 1024,
+        });
+    }
+    try w.print("{s:<22} {d:>9.3} ms\n", .{ "total", nsToMs(total) });
+
+    if (memory) |counting| {
+        try w.print("\n{s:<22} {s:>12} {s:>12} {s:>12}\n", .{ "subsystem", "peak", "total", "allocations" });
+        for (std.enums.values(CountingAllocator.Subsystem)) |subsystem| {
+            const counter = counting.counters.get(subsystem);
+            try w.print("{s:<22} {d:>8} KiB {d:>8} KiB {d:>12}\n", .{
+                @tagName(subsystem),
+                counter.peak / 1024,
+                counter.total / 1024,
+                counter.allocations,
+            });
+        }
+    }
+
+    std.mem.sort(Item, p.items.items, {}, slowerThan);
+    for ([_]Item.Kind{ .decl, .macro }) |kind| {
+        try w.print("\nslowest {s}s:\n", .{@tagName(kind)});
+        var printed: usize = 0;
+        for (p.items.items) |item| {
+            if (printed == top) break;
+            if (item.kind != kind) continue;
+            printed += 1;
+
+            const expanded = item.loc.expand(comp);
+            try w.print("{d:>9.3} ms  {s} ({s}:{d}:{d})\n", .{
+                nsToMs(item.duration),
+                item.name,
+                expanded.path,
+                expanded.line_no,
+                expanded.col,
+            });
+        }
+    }
+}
+
+/// Writes every phase and item as a complete event in the Chrome Trace Event
+/// format, which can be loaded into Perfetto or `chrome://tracing`.
+pub fn writeTrace(p: *Profiler, comp: *aro.Compilation, w: *std.Io.Writer) !void {
+    try w.writeAll("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n");
+    var first = true;
+    for (std.enums.values(Phase)) |phase| {
+        const stats = p.phases.get(phase);
+        if (!stats.ran) continue;
+        if (!first) try w.writeAll(",\n");
+        first = false;
+        try w.print("{{\"name\":\"{s}\",\"cat\":\"phase\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":{d:.3},\"dur\":{d:.3}}}", .{
+            @tagName(phase),
+            nsToUs(stats.start),
+            nsToUs(stats.duration),
+        });
+    }
+    for (p.items.items) |item| {
+        if (!first) try w.writeAll(",\n");
+        first = false;
+        const expanded = item.loc.expand(comp);
+        var loc_buf: [std.fs.max_path_bytes + 32]u8 = undefined;
+        const loc = std.fmt.bufPrint(&loc_buf, "{s}:{d}:{d}", .{ expanded.path, expanded.line_no, expanded.col }) catch expanded.path;
+        try w.print("{{\"name\":{f},\"cat\":\"{s}\",\"ph\":\"X\",\"pid\":0,\"tid\":0,\"ts\":{d:.3},\"dur\":{d:.3},\"args\":{{\"loc\":{f}}}}}", .{
+            std.json.fmt(item.name, .{}),
+            @tagName(item.kind),
+            nsToUs(item.start),
+            nsToUs(item.duration),
+            std.json.fmt(loc, .{}),
+        });
+    }
+    try w.writeAll("\n]}\n");
+}
+
+fn slowerThan(_: void, a: Item, b: Item) bool {
+    return a.duration > b.duration;
+}
+
+fn nsToMs(ns: u64) f64 {
+    return @as(f64, @floatFromInt(ns)) / std.time.ns_per_ms;
+}
+
+fn nsToUs(ns: u64) f64 {
+    return @as(f64, @floatFromInt(ns)) / std.time.ns_per_us;
+}
+
+fn peakRss() usize {
+    switch (builtin.os.tag) {
+        .windows, .wasi, .freestanding => return 0,
+        else => {},
+    }
+    const usage = std.posix.getrusage(std.posix.rusage.SELF);
+    const max_rss: usize = @intCast(usage.maxrss);
+    // Darwin reports bytes, everything else reports kilobytes.
+    return if (builtin.os.tag.isDarwin()) max_rss else max_rss * 1024;
+}
@@ -0,0 +1,171 @@
+//! Records every declaration translate-c could not translate faithfully,
+//! grouped by category and reason. Used by `--stats`.
+const std = @import("std");
+const mem = std.mem;
+
+const aro = @import("aro");
+
+const CountingAllocator = @import("CountingAllocator.zig");
+
+const Stats = @This();
+
+pub const Category = enum {
+    /// Function definitions translated as `extern` declarations.
+    demoted_functions,
+    /// Records translated as `opaque {}` despite having a definition.
+    opaque_demotions,
+    /// Declarations replaced by a `@compileError`.
+    failed_decls,
+    /// Macros replaced by a `@compileError`.
+    failed_macros,
+};
+
+pub const Entry = struct {
+    name: []const u8,
+    /// Shared by every entry with the same cause.
+    reason: []const u8,
+    message: []const u8,
+    loc: aro.Source.Location,
+};
+
+gpa: mem.Allocator,
+/// Owns the names and messages of the entries, which outlive the translator arena.
+arena: std.heap.ArenaAllocator,
+entries: std.EnumArray(Category, std.ArrayList(Entry)) = .initFill(.empty),
+
+pub fn init(gpa: mem.Allocator) Stats {
+    return .{ .gpa = gpa, .arena = .init(gpa) };
+}
+
+pub fn deinit(s: *Stats) void {
+    for (&s.entries.values) |*list| list.deinit(s.gpa);
+    s.arena.deinit();
+}
+
+/// `reason` must outlive `s`; it is typically the comptime format string of a diagnostic.
+pub fn add(
+    s: *Stats,
+    category: Category,
+    name: []const u8,
+    loc: aro.Source.Location,
+    reason: []const u8,
+    comptime format: []const u8,
+    args: anytype,
+) !void {
+    const arena = s.arena.allocator();
+    try s.entries.getPtr(category).append(s.gpa, .{
+        .name = try arena.dupe(u8, name),
+        .reason = reason,
+        .message = try std.fmt.allocPrint(arena, format, args),
+        .loc = loc,
+    });
+}
+
+/// Writes the count, the count per reason and the entries of each category as JSON,
+/// followed by the allocation counters of each subsystem if `memory` is given.
+pub fn write(s: *Stats, comp: *aro.Compilation, memory: ?*const CountingAllocator, w: *std.Io.Writer) !void {
+    var reasons: std.StringArrayHashMapUnmanaged(usize) = .empty;
+    defer reasons.deinit(s.gpa);
+
+    try w.writeAll("{\n");
+    for (std.enums.values(Category), 0..) |category, i| {
+        const entries = s.entries.get(category).items;
+
+        reasons.clearRetainingCapacity();
+        for (entries) |entry| {
+            const gop = try reasons.getOrPut(s.gpa, entry.reason);
+            if (!gop.found_existing) gop.value_ptr.* = 0;
+            gop.value_ptr.* += 1;
+        }
+
+        try w.print("  \"{s}\": {{\n    \"count\": {d},\n    \"reasons\": {{", .{ @tagName(category), entries.len });
+        for (reasons.keys(), reasons.values(), 0..) |reason, count, j| {
+            try w.print("{s}\n      {f}: {d}", .{ if (j == 0) "" else ",", std.json.fmt(reason, .{}), count });
+        }
+        try w.writeAll(if (reasons.count() == 0) "},\n    \"entries\": [" else "\n    },\n    \"entries\": [");
+        for (entries, 0..) |entry, j| {
+            const expanded = entry.loc.expand(comp);
+            var loc_buf: [std.fs.max_path_bytes + 32]u8 = undefined;
+            const loc = std.fmt.bufPrint(&loc_buf, "{s}:{d}:{d}", .{ expanded.path, expanded.line_no, expanded.col }) catch expanded.path;
+            try w.print("{s}\n      {{ \"name\": {f}, \"reason\": {f}, \"message\": {f}, \"loc\": {f} }}", .{
+                if (j == 0) "" else ",",
+                std.json.fmt(entry.name, .{}),
+                std.json.fmt(entry.reason, .{}),
+                std.json.fmt(entry.message, .{}),
+                std.json.fmt(loc, .{}),
+            });
+        }
+        try w.writeAll(if (entries.len == 0) "]\n  }" else "\n    ]\n  }");
+        const last = i + 1 == std.enums.values(Category).len and memory == null;
+        try w.writeAll(if (last) "\n" else ",\n");
+    }
+    if (memory) |counting| {
+        try w.writeAll("  \"memory\": {");
+        for (std.enums.values(CountingAllocator.Subsystem), 0..) |subsystem, i| {
+            const counter = counting.counters.get(subsystem);
+            try w.print("{s}\n    \"{s}\": {{ \"peak\": {d}, \"total\": {d}, \"allocations\": {d} }}", .{
+                if (i == 0) "" else ",",
+                @tagName(subsystem),
+                counter.peak,
+                counter.total,
+                counter.allocations,
+            });
+        }
+        try w.writeAll("\n  }\n");
+    }
+    try w.writeAll("}\n");
+}
+
+test Stats {
+    const gpa = std.testing.allocator;
+    var arena_instance: std.heap.ArenaAllocator = .init(gpa);
+    defer arena_instance.deinit();
+    var threaded: std.Io.Threaded = .init(gpa);
+    defer threaded.deinit();
+    var diagnostics: aro.Diagnostics = .{ .output = .ignore };
+    var comp = try aro.Compilation.initDefault(gpa, arena_instance.allocator(), threaded.io(), &diagnostics, std.fs.cwd());
+    defer comp.deinit();
+    const source = try comp.addSourceFromBuffer("test.h", "int f(void);\n#define M (\n");
+
+    var stats: Stats = .init(gpa);
+    defer stats.deinit();
+    try stats.add(.demoted_functions, "f", .{ .id = source.id, .byte_offset = 4, .line = 1 }, "TODO goto", "unable to translate function, demoted to extern", .{});
+    try stats.add(.failed_macros, "M", .{ .id = source.id, .byte_offset = 21, .line = 2 }, "unable to translate macro", "unable to translate macro {s}", .{"M"});
+
+    var out: std.Io.Writer.Allocating = .init(gpa);
+    defer out.deinit();
+    try stats.write(&comp, null, &out.writer);
+    try std.testing.expectEqualStrings(
+        \\{
+        \\  "demoted_functions": {
+        \\    "count": 1,
+        \\    "reasons": {
+        \\      "TODO goto": 1
+        \\    },
+        \\    "entries": [
+        \\      { "name": "f", "reason": "TODO goto", "message": "unable to translate function, demoted to extern", "loc": "test.h:1:5" }
+        \\    ]
+        \\  },
+        \\  "opaque_demotions": {
+        \\    "count": 0,
+        \\    "reasons": {},
+        \\    "entries": []
+        \\  },
+        \\  "failed_decls": {
+        \\    "count": 0,
+        \\    "reasons": {},
+        \\    "entries": []
+        \\  },
+        \\  "failed_macros": {
+        \\    "count": 1,
+        \\    "reasons": {
+        \\      "unable to translate macro": 1
+        \\    },
+        \\    "entries": [
+        \\      { "name": "M", "reason": "unable to translate macro", "message": "unable to translate macro M", "loc": "test.h:2:9" }
+        \\    ]
+        \\  }
+        \\}
+        \\
+    , out.written());
+}
@@ -15,9 +15,12 @@ const ZigNode = ast.Node;
 const ZigTag = ZigNode.Tag;
 const builtins = @import("builtins.zig");
 const helpers = @import("helpers.zig");
+const CountingAllocator = @import("CountingAllocator.zig");
 const MacroTranslator = @import("MacroTranslator.zig");
 const PatternList = @import("PatternList.zig");
+const Profiler = @import("Profiler.zig");
 const Scope = @import("Scope.zig");
+const Stats = @import("Stats.zig");
 
 const AnonymousRecordFieldNames = struct {
     pub const Key = struct {
@@ -121,6 +124,47 @@ compound_assign_dummy: ?ZigNode = null,
 /// Used to detect self-referential initializers.
 wip_var_inits: std.AutoHashMapUnmanaged(Node.Index, void) = .empty,
 
+/// Set of local variables used as loop induction variables that were shown
+/// to never hold a negative value. Used to avoid sign extending indexes.
+nonnegative_locals: std.AutoHashMapUnmanaged(Node.Index, void) = .empty,
+
+/// Translate `static inline` function definitions as Zig `inline fn`s.
+inline_static_fns: bool = false,
+/// Set of identifiers that appear somewhere other than directly before a '('.
+/// Functions in this set may have their address taken and cannot be made inline.
+/// Populated on first use.
+non_call_refs: std.StringHashMapUnmanaged(void) = .empty,
+non_call_refs_populated: bool = false,
+/// Set of `static inline` functions which are part of a cycle of calls between such functions.
+/// Inline fns cannot be recursive, so these are translated as regular fns. Populated on first use.
+recursive_inline_fns: std.StringHashMapUnmanaged(void) = .empty,
+
+/// Translate static local variables as file scope variables instead of
+/// wrapping them in a block-local struct.
+hoist_static_locals: bool = false,
+/// Names of the file scope variables created for hoisted static locals.
+hoisted_static_locals: std.StringHashMapUnmanaged(void) = .empty,
+
+/// Records the time spent in each phase, declaration and macro, if enabled.
+profiler: ?*Profiler = null,
+/// Records demoted and failed declarations, if enabled.
+stats: ?*Stats = null,
+/// Format string of the last `fail` diagnostic, used as the cause of a function demotion.
+/// Reset whenever such a failure is recovered from so that it is not blamed for a later one.
+last_fail_reason: ?[]const u8 = null,
+/// A translation of common headers whose declarations are imported instead of translated.
+base: ?*const Base = null,
+/// Whether each source is one of the headers the base was translated from. Populated on first use.
+base_sources: std.AutoHashMapUnmanaged(aro.Source.Id, bool) = .empty,
+/// Names the base declares but which this translation declares itself, from a header the base
+/// did not cover, e.g. a macro the header redefines. `importBase` keeps these.
+base_overrides: std.StringHashMapUnmanaged(void) = .empty,
+/// Record the header each top-level declaration comes from in `file_ranges`.
+split: bool = false,
+/// The header that each range of `global_scope.nodes` was translated from, starting at the
+/// node index `start`. Nodes of ranges without a source are placed in the root file.
+file_ranges: std.ArrayList(struct { start: usize, source: ?aro.Source.Id }) = .empty,
+
 pub fn getMangle(t: *Translator) u32 {
     t.mangle_count += 1;
     return t.mangle_count;
@@ -157,6 +201,7 @@ fn fail(
     args: anytype,
 ) (@TypeOf(err) || error{OutOfMemory}) {
     try t.warn(&t.global_scope.base, source_loc, format, args);
+    t.last_fail_reason = format;
     return err;
 }
 
@@ -169,9 +214,22 @@ pub fn failDecl(
     args: anytype,
 ) Error!void {
     const loc = t.tree.tokens.items(.loc)[tok_idx];
+    t.last_fail_reason = null;
+    if (t.stats) |stats| try stats.add(.failed_decls, name, loc, format, format, args);
     return t.failDeclExtra(scope, loc, name, format, args);
 }
 
+pub fn failMacro(
+    t: *Translator,
+    loc: aro.Source.Location,
+    name: []const u8,
+    comptime format: []const u8,
+    args: anytype,
+) Error!void {
+    if (t.stats) |stats| try stats.add(.failed_macros, name, loc, format, format, args);
+    return t.failDeclExtra(&t.global_scope.base, loc, name, format, args);
+}
+
 pub fn failDeclExtra(
     t: *Translator,
     scope: *Scope,
@@ -212,17 +270,80 @@ fn warn(t: *Translator, scope: *Scope, tok_idx: TokenIndex, comptime format: []c
     try scope.appendNode(try ZigTag.warning.create(t.arena, value));
 }
 
+/// Like `warn`, but also records the demotion of `name` when collecting stats.
+fn warnDemoted(
+    t: *Translator,
+    scope: *Scope,
+    category: Stats.Category,
+    name: []const u8,
+    tok_idx: TokenIndex,
+    comptime format: []const u8,
+    args: anytype,
+) !void {
+    try t.warn(scope, tok_idx, format, args);
+    if (t.stats) |stats| try stats.add(category, name, t.tree.tokens.items(.loc)[tok_idx], format, format, args);
+}
+
 pub const Options = struct {
     gpa: mem.Allocator,
     comp: *aro.Compilation,
     pp: *const aro.Preprocessor,
     tree: *const aro.Tree,
     module_libs: bool,
+    inline_static_fns: bool = false,
+    hoist_static_locals: bool = false,
+    profiler: ?*Profiler = null,
+    stats: ?*Stats = null,
+    /// If set, allocations are counted per `CountingAllocator.Subsystem`.
+    memory: ?*CountingAllocator = null,
+    base: ?*const Base = null,
+    /// If set, the paths of the translated headers, each prefixed with `#`, and the names of
+    /// the public top-level declarations are written to it, one per line, so that this
+    /// translation can be used as the `Base` of others.
+    names_out: ?*std.Io.Writer = null,
+    /// If set, the declarations of each header are rendered into a separate file, and the
+    /// returned root file only re-exports them.
+    split: ?*Split = null,
+};
+
+/// The files of a translation split into one file per header, which Zig only parses when a
+/// declaration of the header is used.
+pub const Split = struct {
+    /// The name of the root file, which the other files import to refer to each other.
+    root_name: []const u8,
+    /// Files to write next to the root file, allocated with `Options.gpa`.
+    files: std.ArrayList(File) = .empty,
+
+    pub const File = struct {
+        name: []u8,
+        source: []u8,
+    };
+
+    pub fn deinit(split: *Split, gpa: mem.Allocator) void {
+        for (split.files.items) |file| {
+            gpa.free(file.name);
+            gpa.free(file.source);
+        }
+        split.files.deinit(gpa);
+    }
+};
+
+/// Another translation of headers included by this one, typically those of libc. Declarations
+/// and macros it already defines are not translated again but aliased from it instead.
+pub const Base = struct {
+    /// The name under which the base translation is imported.
+    module: []const u8,
+    /// The public top-level names of the base translation, in the order they are declared.
+    names: std.StringArrayHashMapUnmanaged(void),
+    /// The normalized paths of the headers the base translation was translated from. Only
+    /// declarations and macros from these headers are taken from the base.
+    sources: std.StringHashMapUnmanaged(void) = .empty,
 };
 
 pub fn translate(options: Options) mem.Allocator.Error![]u8 {
-    const gpa = options.gpa;
-    var arena_allocator = std.heap.ArenaAllocator.init(gpa);
+    const gpa = if (options.memory) |memory| memory.allocator(.translator) else options.gpa;
+    const render_gpa = if (options.memory) |memory| memory.allocator(.render) else options.gpa;
+    var arena_allocator = std.heap.ArenaAllocator.init(if (options.memory) |memory| memory.allocator(.arena) else options.gpa);
     defer arena_allocator.deinit();
     const arena = arena_allocator.allocator();
 
@@ -234,8 +355,15 @@ pub fn translate(options: Options) mem.Allocator.Error![]u8 {
         .comp = options.comp,
         .pp = options.pp,
         .tree = options.tree,
+        .inline_static_fns = options.inline_static_fns,
+        .hoist_static_locals = options.hoist_static_locals,
+        .profiler = options.profiler,
+        .stats = options.stats,
+        .base = options.base,
+        .split = options.split != null,
     };
     translator.global_scope.* = Scope.Root.init(&translator);
+    if (options.profiler) |profiler| profiler.arena = &arena_allocator;
     defer {
         translator.type_decls.deinit(gpa);
         translator.alias_list.deinit(gpa);
@@ -247,15 +375,33 @@ pub fn translate(options: Options) mem.Allocator.Error![]u8 {
         translator.typedefs.deinit(gpa);
         translator.global_scope.deinit();
         translator.wip_var_inits.deinit(gpa);
+        translator.nonnegative_locals.deinit(gpa);
+        translator.non_call_refs.deinit(gpa);
+        translator.recursive_inline_fns.deinit(gpa);
+        translator.hoisted_static_locals.deinit(gpa);
+        translator.base_sources.deinit(gpa);
+        translator.base_overrides.deinit(gpa);
+        translator.file_ranges.deinit(gpa);
+        if (options.profiler) |profiler| profiler.arena = null;
     }
 
+    translator.beginPhase();
     try translator.prepopulateGlobalNameTable();
+    translator.endPhase(.prepopulate_names);
+
+    translator.beginPhase();
     try translator.transTopLevelDecls();
+    translator.endPhase(.translate_decls);
 
     // Insert empty line before macros.
     try translator.global_scope.nodes.append(gpa, try ZigTag.warning.create(arena, "\n"));
 
+    translator.beginPhase();
     try translator.transMacros();
+    translator.endPhase(.translate_macros);
+
+    // Aliases added from here on are declared by the root file.
+    try translator.enterFile(null);
 
     for (translator.alias_list.items) |alias| {
         if (!translator.global_scope.sym_table.contains(alias.alias)) {
@@ -264,9 +410,16 @@ pub fn translate(options: Options) mem.Allocator.Error![]u8 {
         }
     }
 
+    translator.beginPhase();
     try translator.global_scope.processContainerMemberFns();
+    translator.endPhase(.container_member_fns);
+
+    if (options.base) |base| try translator.importBase(base);
 
-    var allocating: std.Io.Writer.Allocating = .init(gpa);
+    if (options.names_out) |w| try translator.writeNames(w);
+
+    // The result is owned by the caller, so allocate it with the caller's allocator.
+    var allocating: std.Io.Writer.Allocating = .init(options.gpa);
     defer allocating.deinit();
 
     allocating.writer.writeAll(
@@ -289,16 +442,390 @@ pub fn translate(options: Options) mem.Allocator.Error![]u8 {
             \\
         ) catch return error.OutOfMemory;
     }
+    if (options.base) |base| {
+        allocating.writer.print("pub const __base = @import(\"{f}\");\n\n", .{std.zig.fmtString(base.module)}) catch
+            return error.OutOfMemory;
+    }
 
-    var zig_ast = try ast.render(gpa, translator.global_scope.nodes.items);
+    var root_nodes = translator.global_scope.nodes.items;
+    if (options.split) |split| {
+        root_nodes = try translator.splitFiles(split, options, render_gpa, &allocating.writer);
+    }
+
+    translator.beginPhase();
+    var zig_ast = try ast.render(render_gpa, root_nodes);
     defer {
-        gpa.free(zig_ast.source);
-        zig_ast.deinit(gpa);
+        render_gpa.free(zig_ast.source);
+        zig_ast.deinit(render_gpa);
     }
-    zig_ast.render(gpa, &allocating.writer, .{}) catch return error.OutOfMemory;
+    translator.endPhase(.build_ast);
+
+    translator.beginPhase();
+    zig_ast.render(render_gpa, &allocating.writer, .{}) catch return error.OutOfMemory;
+    translator.endPhase(.render);
     return allocating.toOwnedSlice();
 }
 
+/// Places the top-level nodes added from now on in the file of `source` if the output is split.
+/// Declarations from the command line or from generated sources go to the root file.
+fn enterFile(t: *Translator, source: ?aro.Source.Id) !void {
+    if (!t.split) return;
+    const file: ?aro.Source.Id = if (source) |id|
+        if (mem.startsWith(u8, t.comp.getSource(id).path, "<")) null else id
+    else
+        null;
+    if (t.file_ranges.items.len > 0 and std.meta.eql(t.file_ranges.items[t.file_ranges.items.len - 1].source, file)) return;
+    try t.file_ranges.append(t.gpa, .{ .start = t.global_scope.nodes.items.len, .source = file });
+}
+
+/// Renders the top-level nodes of each header into a file of `split`, prefixed with imports of
+/// the names it uses from the other files. Writes a re-export of every public declaration of
+/// those files to `root_w`, and returns the nodes which remain in the root file.
+fn splitFiles(
+    t: *Translator,
+    split: *Split,
+    options: Options,
+    render_gpa: mem.Allocator,
+    root_w: *std.Io.Writer,
+) ![]ZigNode {
+    const nodes = t.global_scope.nodes.items;
+
+    // The nodes of each header, followed by those of the root file.
+    var file_nodes: std.ArrayList(std.ArrayList(ZigNode)) = .empty;
+    var file_sources: std.AutoArrayHashMapUnmanaged(aro.Source.Id, void) = .empty;
+    defer file_sources.deinit(t.gpa);
+    var root_nodes: std.ArrayList(ZigNode) = .empty;
+    var owners: std.StringHashMapUnmanaged(Owner) = .empty;
+    defer owners.deinit(t.gpa);
+
+    var range: usize = 0;
+    var source: ?aro.Source.Id = null;
+    for (nodes, 0..) |node, i| {
+        while (range < t.file_ranges.items.len and t.file_ranges.items[range].start <= i) : (range += 1) {
+            source = t.file_ranges.items[range].source;
+        }
+        var file: u32 = Owner.root;
+        if (source) |id| {
+            const gop = try file_sources.getOrPut(t.gpa, id);
+            if (!gop.found_existing) try file_nodes.append(t.arena, .empty);
+            try file_nodes.items[gop.index].append(t.arena, node);
+            file = @intCast(gop.index);
+        } else {
+            try root_nodes.append(t.arena, node);
+        }
+        if (declName(node)) |name| _ = try owners.getOrPutValue(t.gpa, name, .{ .file = file, .node = node });
+    }
+
+    const trees = try t.arena.alloc(?std.zig.Ast, file_nodes.items.len);
+    @memset(trees, null);
+    defer for (trees) |*maybe_tree| if (maybe_tree.*) |*tree| {
+        render_gpa.free(tree.source);
+        tree.deinit(render_gpa);
+    };
+    const imports = try t.arena.alloc(std.StringArrayHashMapUnmanaged(void), file_nodes.items.len);
+    @memset(imports, .empty);
+    defer for (imports) |*map| map.deinit(t.gpa);
+    const promoted = try t.arena.alloc(bool, file_nodes.items.len);
+    @memset(promoted, false);
+
+    // Find the names each file uses from another one. Declarations used by another file must
+    // be public for the root file to re-export them.
+    for (file_nodes.items, trees, imports, 0..) |list, *tree, *map, file| {
+        tree.* = try ast.render(render_gpa, list.items);
+        try t.collectImports(&tree.*.?, &owners, @intCast(file), map);
+    }
+    var root_imports: std.StringArrayHashMapUnmanaged(void) = .empty;
+    defer root_imports.deinit(t.gpa);
+    {
+        var root_tree = try ast.render(render_gpa, root_nodes.items);
+        defer {
+            render_gpa.free(root_tree.source);
+            root_tree.deinit(render_gpa);
+        }
+        try t.collectImports(&root_tree, &owners, Owner.root, &root_imports);
+    }
+    for (imports) |map| makeImportsPub(map, &owners, promoted);
+    makeImportsPub(root_imports, &owners, promoted);
+
+    var used_names: std.StringHashMapUnmanaged(void) = .empty;
+    defer used_names.deinit(t.gpa);
+    try used_names.put(t.gpa, split.root_name, {});
+
+    try split.files.ensureUnusedCapacity(options.gpa, file_nodes.items.len);
+    for (file_sources.keys(), file_nodes.items, trees, imports, promoted) |id, list, *tree, map, is_promoted| {
+        const basename = std.fs.path.basename(t.comp.getSource(id).path);
+        var name = try std.fmt.allocPrint(options.gpa, "{s}.zig", .{basename});
+        var suffix: u32 = 1;
+        while (used_names.contains(name)) : (suffix += 1) {
+            options.gpa.free(name);
+            name = try std.fmt.allocPrint(options.gpa, "{s}_{d}.zig", .{ basename, suffix });
+        }
+        errdefer options.gpa.free(name);
+        try used_names.put(t.gpa, name, {});
+
+        if (is_promoted) {
+            render_gpa.free(tree.*.?.source);
+            tree.*.?.deinit(render_gpa);
+            tree.* = null;
+            tree.* = try ast.render(render_gpa, list.items);
+        }
+
+        var out: std.Io.Writer.Allocating = .init(options.gpa);
+        defer out.deinit();
+        const w = &out.writer;
+        w.print(
+            \\const __root = @import("{f}");
+            \\const __builtin = __root.__builtin;
+            \\const __helpers = __root.__helpers;
+            \\
+        , .{std.zig.fmtString(split.root_name)}) catch return error.OutOfMemory;
+        if (options.base != null) w.writeAll("const __base = __root.__base;\n") catch return error.OutOfMemory;
+        for (map.keys()) |ident| {
+            w.print("const {f} = __root.{f};\n", .{ std.zig.fmtId(ident), std.zig.fmtId(ident) }) catch
+                return error.OutOfMemory;
+        }
+        w.writeAll("\n") catch return error.OutOfMemory;
+        tree.*.?.render(render_gpa, w, .{}) catch return error.OutOfMemory;
+
+        var has_exports = false;
+        for (list.items) |node| {
+            has_exports = has_exports or isExport(node);
+            const decl_name = pubDeclName(node) orelse continue;
+            root_w.print("pub const {f} = @import(\"{f}\").{f};\n", .{
+                std.zig.fmtId(decl_name),
+                std.zig.fmtString(name),
+                std.zig.fmtId(decl_name),
+            }) catch return error.OutOfMemory;
+        }
+        // Exported declarations are only analyzed if their file is.
+        if (has_exports) {
+            root_w.print(
+                \\comptime {{
+                \\    _ = @import("{f}");
+                \\}}
+                \\
+            , .{std.zig.fmtString(name)}) catch return error.OutOfMemory;
+        }
+        root_w.writeAll("\n") catch return error.OutOfMemory;
+
+        split.files.appendAssumeCapacity(.{ .name = name, .source = try out.toOwnedSlice() });
+    }
+
+    return root_nodes.items;
+}
+
+/// The file declaring a top-level name when splitting the output.
+const Owner = struct {
+    /// An index of a header file, or `root`.
+    file: u32,
+    node: ZigNode,
+
+    const root = std.math.maxInt(u32);
+};
+
+/// Adds to `imports` every top-level name which `tree` uses but which is declared by another
+/// file than `file`.
+fn collectImports(
+    t: *Translator,
+    tree: *const std.zig.Ast,
+    owners: *const std.StringHashMapUnmanaged(Owner),
+    file: u32,
+    imports: *std.StringArrayHashMapUnmanaged(void),
+) !void {
+    const tags = tree.tokens.items(.tag);
+    for (tags, 0..) |tag, tok| {
+        if (tag != .identifier or (tok > 0 and tags[tok - 1] == .period)) continue;
+        const slice = tree.tokenSlice(@intCast(tok));
+        const ident = if (slice[0] == '@')
+            std.zig.string_literal.parseAlloc(t.arena, slice[1..]) catch continue
+        else
+            slice;
+        const entry = owners.getEntry(ident) orelse continue;
+        if (entry.value_ptr.file != file) try imports.put(t.gpa, entry.key_ptr.*, {});
+    }
+}
+
+/// Makes the declarations of the names in `imports` public, and marks the header files whose
+/// declarations changed in `promoted`.
+fn makeImportsPub(
+    imports: std.StringArrayHashMapUnmanaged(void),
+    owners: *const std.StringHashMapUnmanaged(Owner),
+    promoted: []bool,
+) void {
+    for (imports.keys()) |name| {
+        const owner = owners.get(name).?;
+        if (pubDeclName(owner.node) != null) continue;
+        switch (owner.node.tag()) {
+            .var_simple => owner.node.ptr_otherwise.tag = .pub_var_simple,
+            .var_decl => owner.node.castTag(.var_decl).?.data.is_pub = true,
+            .func => owner.node.castTag(.func).?.data.is_pub = true,
+            .enum_constant => owner.node.castTag(.enum_constant).?.data.is_public = true,
+            else => continue,
+        }
+        if (owner.file != Owner.root) promoted[owner.file] = true;
+    }
+}
+
+/// Returns the name of `node` if it is a top-level declaration.
+fn declName(node: ZigNode) ?[]const u8 {
+    return switch (node.tag()) {
+        .var_simple => node.castTag(.var_simple).?.data.name,
+        .enum_constant => node.castTag(.enum_constant).?.data.name,
+        .var_decl => node.castTag(.var_decl).?.data.name,
+        .func => node.castTag(.func).?.data.name,
+        else => pubDeclName(node),
+    };
+}
+
+fn isExport(node: ZigNode) bool {
+    return switch (node.tag()) {
+        .var_decl => node.castTag(.var_decl).?.data.is_export,
+        .func => node.castTag(.func).?.data.is_export,
+        else => false,
+    };
+}
+
+/// Replaces the public top-level declarations that the base translation also declares with
+/// aliases of its declarations, and aliases the base declarations this translation skipped
+/// but still refers to.
+fn importBase(t: *Translator, base: *const Base) !void {
+    var declared: std.StringHashMapUnmanaged(void) = .empty;
+    defer declared.deinit(t.gpa);
+
+    for (t.global_scope.nodes.items) |*node| {
+        const name = pubDeclName(node.*) orelse continue;
+        if (!base.names.contains(name) or t.base_overrides.contains(name)) continue;
+        try declared.put(t.gpa, name, {});
+        node.* = try t.baseAlias(name);
+    }
+
+    // Only alias the base declarations this translation refers to; the rest stay reachable
+    // through the base module itself.
+    var tree = try ast.render(t.gpa, t.global_scope.nodes.items);
+    defer {
+        t.gpa.free(tree.source);
+        tree.deinit(t.gpa);
+    }
+    var referenced: std.StringArrayHashMapUnmanaged(void) = .empty;
+    defer referenced.deinit(t.gpa);
+    const tags = tree.tokens.items(.tag);
+    for (tags, 0..) |tag, tok| {
+        if (tag != .identifier or (tok > 0 and tags[tok - 1] == .period)) continue;
+        const slice = tree.tokenSlice(@intCast(tok));
+        const ident = if (slice[0] == '@')
+            std.zig.string_literal.parseAlloc(t.arena, slice[1..]) catch continue
+        else
+            slice;
+        const name = base.names.getKey(ident) orelse continue;
+        if (declared.contains(name) or t.global_scope.sym_table.contains(name)) continue;
+        try referenced.put(t.gpa, name, {});
+    }
+    for (referenced.keys()) |name| {
+        try t.global_scope.nodes.append(t.gpa, try t.baseAlias(name));
+    }
+}
+
+/// pub const name = __base.name;
+fn baseAlias(t: *Translator, name: []const u8) !ZigNode {
+    return ZigTag.pub_var_simple.create(t.arena, .{
+        .name = name,
+        .init = try ZigTag.field_access.create(t.arena, .{
+            .lhs = try ZigTag.identifier.create(t.arena, "__base"),
+            .field_name = name,
+        }),
+    });
+}
+
+/// Returns the name of `node` if it is a public top-level declaration.
+fn pubDeclName(node: ZigNode) ?[]const u8 {
+    return switch (node.tag()) {
+        .pub_var_simple => node.castTag(.pub_var_simple).?.data.name,
+        .pub_inline_fn => node.castTag(.pub_inline_fn).?.data.name,
+        .alias => node.castTag(.alias).?.data.actual,
+        .fail_decl => {
+            const payload = node.castTag(.fail_decl).?.data;
+            return if (payload.local) null else payload.actual;
+        },
+        .enum_constant => {
+            const payload = node.castTag(.enum_constant).?.data;
+            return if (payload.is_public) payload.name else null;
+        },
+        .var_decl => {
+            const payload = node.castTag(.var_decl).?.data;
+            return if (payload.is_pub) payload.name else null;
+        },
+        .func => {
+            const payload = node.castTag(.func).?.data;
+            return if (payload.is_pub) payload.name else null;
+        },
+        else => null,
+    };
+}
+
+/// Whether `decl` comes from a header the base translation covered and is declared under the
+/// same name by it. Records and enums are only named once translated, so `importBase` replaces
+/// them afterwards instead.
+fn isInBase(t: *Translator, decl: Node.Index) !bool {
+    const name_tok = switch (decl.get(t.tree)) {
+        .typedef => |typedef_decl| typedef_decl.name_tok,
+        .function => |function| function.name_tok,
+        .variable => |variable| variable.name_tok,
+        else => return false,
+    };
+    return t.isNameInBase(t.tree.tokSlice(name_tok), t.tree.tokens.items(.loc)[name_tok].id);
+}
+
+/// Whether `name`, declared in `source`, is taken from the base translation. Names the base
+/// declares but which are declared in another header are recorded in `base_overrides`.
+fn isNameInBase(t: *Translator, name: []const u8, source: aro.Source.Id) !bool {
+    const base = t.base orelse return false;
+    if (!base.names.contains(name)) return false;
+
+    const gop = try t.base_sources.getOrPut(t.gpa, source);
+    if (!gop.found_existing) {
+        const path = try std.fs.path.resolve(t.gpa, &.{t.comp.getSource(source).path});
+        defer t.gpa.free(path);
+        gop.value_ptr.* = base.sources.contains(path);
+    }
+    if (!gop.value_ptr.*) try t.base_overrides.put(t.gpa, name, {});
+    return gop.value_ptr.*;
+}
+
+/// Writes the paths of the headers declarations and macros were translated from, followed by
+/// the names of the public top-level declarations. See `Options.names_out`.
+fn writeNames(t: *Translator, w: *std.Io.Writer) !void {
+    var sources: std.AutoArrayHashMapUnmanaged(aro.Source.Id, void) = .empty;
+    defer sources.deinit(t.gpa);
+    for (t.tree.root_decls.items) |decl| {
+        try sources.put(t.gpa, t.tree.tokens.items(.loc)[decl.tok(t.tree)].id, {});
+    }
+    for (t.pp.defines.values()) |macro| {
+        if (macro.isBuiltin()) continue;
+        try sources.put(t.gpa, macro.loc.id, {});
+    }
+
+    var paths: std.StringHashMapUnmanaged(void) = .empty;
+    defer paths.deinit(t.gpa);
+    for (sources.keys()) |source| {
+        const path = try std.fs.path.resolve(t.arena, &.{t.comp.getSource(source).path});
+        if ((try paths.getOrPut(t.gpa, path)).found_existing) continue;
+        w.print("#{s}\n", .{path}) catch return error.OutOfMemory;
+    }
+
+    for (t.global_scope.nodes.items) |node| {
+        const name = pubDeclName(node) orelse continue;
+        w.print("{s}\n", .{name}) catch return error.OutOfMemory;
+    }
+}
+
+fn beginPhase(t: *Translator) void {
+    if (t.profiler) |profiler| profiler.beginPhase();
+}
+
+fn endPhase(t: *Translator, phase: Profiler.Phase) void {
+    if (t.profiler) |profiler| profiler.endPhase(phase);
+}
+
 fn prepopulateGlobalNameTable(t: *Translator) !void {
     for (t.tree.root_decls.items) |decl| {
         switch (decl.get(t.tree)) {
@@ -390,7 +917,14 @@ fn isSelfDefinedMacro(t: *Translator, name: []const u8, macro: aro.Preprocessor.
 
 fn transTopLevelDecls(t: *Translator) !void {
     for (t.tree.root_decls.items) |decl| {
+        if (try t.isInBase(decl)) continue;
+        try t.enterFile(t.tree.tokens.items(.loc)[decl.tok(t.tree)].id);
+        const start = if (t.profiler) |profiler| profiler.now() else 0;
         try t.transDecl(&t.global_scope.base, decl);
+        if (t.profiler) |profiler| {
+            const tok = decl.tok(t.tree);
+            try profiler.addItem(.decl, t.tree.tokSlice(tok), t.tree.tokens.items(.loc)[tok], start);
+        }
     }
 }
 
@@ -589,14 +1123,14 @@ fn transRecordDecl(t: *Translator, scope: *Scope, record_qt: QualType) Error!voi
             // Demote record to opaque if it contains a bitfield
             if (field.bit_width != .null) {
                 try t.opaque_demotes.put(t.gpa, base.qt, {});
-                try t.warn(scope, field_loc, "{s} demoted to opaque type - has bitfield", .{container_kind_name});
+                try t.warnDemoted(scope, .opaque_demotions, name, field_loc, "{s} demoted to opaque type - has bitfield", .{container_kind_name});
                 break :init ZigTag.opaque_literal.init();
             }
 
             // Demote record to opaque if it contains an opaque field
             if (t.typeWasDemotedToOpaque(field.qt)) {
                 try t.opaque_demotes.put(t.gpa, base.qt, {});
-                try t.warn(scope, field_loc, "{s} demoted to opaque type - has opaque field", .{container_kind_name});
+                try t.warnDemoted(scope, .opaque_demotions, name, field_loc, "{s} demoted to opaque type - has opaque field", .{container_kind_name});
                 break :init ZigTag.opaque_literal.init();
             }
 
@@ -623,7 +1157,10 @@ fn transRecordDecl(t: *Translator, scope: *Scope, record_qt: QualType) Error!voi
                     if (array_ty.len != .incomplete and (array_ty.len != .fixed or array_ty.len.fixed != 0)) break :flexible;
 
                     const elem_type = t.transType(scope, array_ty.elem, field_loc) catch |err| switch (err) {
-                        error.UnsupportedType => break :flexible,
+                        error.UnsupportedType => {
+                            t.last_fail_reason = null;
+                            break :flexible;
+                        },
                         else => |e| return e,
                     };
                     const zero_array = try ZigTag.array_type.create(t.arena, .{ .len = 0, .elem_type = elem_type });
@@ -639,8 +1176,9 @@ fn transRecordDecl(t: *Translator, scope: *Scope, record_qt: QualType) Error!voi
 
                 break :field_type t.transType(scope, field.qt, field_loc) catch |err| switch (err) {
                     error.UnsupportedType => {
+                        t.last_fail_reason = null;
                         try t.opaque_demotes.put(t.gpa, base.qt, {});
-                        try t.warn(scope, field.name_tok, "{s} demoted to opaque type - unable to translate type of field {s}", .{
+                        try t.warnDemoted(scope, .opaque_demotions, name, field.name_tok, "{s} demoted to opaque type - unable to translate type of field {s}", .{
                             container_kind_name,
                             field_name,
                         });
@@ -723,6 +1261,14 @@ fn transRecordDecl(t: *Translator, scope: *Scope, record_qt: QualType) Error!voi
 }
 
 fn transFnDecl(t: *Translator, scope: *Scope, function: Node.Function) Error!void {
+    const profiler = t.profiler orelse return t.transFnDeclInner(scope, function);
+    const start = profiler.now();
+    try t.transFnDeclInner(scope, function);
+    const loc = t.tree.tokens.items(.loc)[function.name_tok];
+    try profiler.addItem(.function, t.tree.tokSlice(function.name_tok), loc, start);
+}
+
+fn transFnDeclInner(t: *Translator, scope: *Scope, function: Node.Function) Error!void {
     const func_ty = function.qt.get(t.comp, .func).?;
 
     const is_pub = scope.id == .root;
@@ -734,15 +1280,29 @@ fn transFnDecl(t: *Translator, scope: *Scope, function: Node.Function) Error!voi
     const fn_decl_loc = function.name_tok;
     const has_body = function.body != null and func_ty.kind != .variadic;
     if (function.body != null and func_ty.kind == .variadic) {
-        try t.warn(scope, function.name_tok, "TODO unable to translate variadic function, demoted to extern", .{});
+        try t.warnDemoted(scope, .demoted_functions, fn_name, function.name_tok, "TODO unable to translate variadic function, demoted to extern", .{});
     }
 
-    const is_always_inline = has_body and function.qt.getAttribute(t.comp, .always_inline) != null;
+    const is_always_inline = has_body and (function.qt.getAttribute(t.comp, .always_inline) != null or
+        (t.inline_static_fns and function.static and function.@"inline" and try t.isInlinable(fn_name)));
+
+    // `__helpers.BFloat16` is passed like an integer but the C ABI passes `__bf16` in floating
+    // point registers, so such functions can neither be called from nor exported to C.
+    var is_export = !function.static and has_body and !is_always_inline and !function.@"inline";
+    if (t.hasBf16InSignature(func_ty)) {
+        if (!has_body) {
+            return t.failDecl(scope, fn_decl_loc, fn_name, "unable to translate extern function with __bf16 in its signature", .{});
+        }
+        if (is_export) {
+            try t.warn(scope, fn_decl_loc, "function {s} has __bf16 in its signature, not exported", .{fn_name});
+            is_export = false;
+        }
+    }
     const proto_ctx: FnProtoContext = .{
         .fn_name = fn_name,
         .is_always_inline = is_always_inline,
         .is_extern = !has_body,
-        .is_export = !function.static and has_body and !is_always_inline and !function.@"inline",
+        .is_export = is_export,
         .is_pub = is_pub,
         .has_body = has_body,
         .cc = if (function.qt.getAttribute(t.comp, .calling_convention)) |some| switch (some.cc) {
@@ -793,13 +1353,18 @@ fn transFnDecl(t: *Translator, scope: *Scope, function: Node.Function) Error!voi
     block_scope.return_type = func_ty.return_type;
     defer block_scope.deinit();
 
+    if (function.qt.getAttribute(t.comp, .cold) != null) {
+        // Must be the first statement of the function body.
+        try block_scope.statements.append(t.gpa, try t.createBranchHintNode("cold"));
+    }
+
     var param_id: c_uint = 0;
     for (proto_payload.data.params, func_ty.params) |*param, param_info| {
         const param_name = param.name orelse {
             proto_payload.data.is_extern = true;
             proto_payload.data.is_export = false;
             proto_payload.data.is_inline = false;
-            try t.warn(&t.global_scope.base, fn_decl_loc, "function {s} parameter has no name, demoted to extern", .{fn_name});
+            try t.warnDemoted(&t.global_scope.base, .demoted_functions, fn_name, fn_decl_loc, "function {s} parameter has no name, demoted to extern", .{fn_name});
             return t.addTopLevelDecl(fn_name, proto_node);
         };
 
@@ -821,6 +1386,7 @@ fn transFnDecl(t: *Translator, scope: *Scope, function: Node.Function) Error!voi
         param_id += 1;
     }
 
+    t.last_fail_reason = null;
     t.transCompoundStmtInline(body_stmt, &block_scope) catch |err| switch (err) {
         error.OutOfMemory => |e| return e,
         error.SelfReferential => unreachable,
@@ -830,11 +1396,28 @@ fn transFnDecl(t: *Translator, scope: *Scope, function: Node.Function) Error!voi
             proto_payload.data.is_extern = true;
             proto_payload.data.is_export = false;
             proto_payload.data.is_inline = false;
-            try t.warn(&t.global_scope.base, fn_decl_loc, "unable to translate function, demoted to extern", .{});
+            const format = "unable to translate function, demoted to extern";
+            try t.warn(&t.global_scope.base, fn_decl_loc, format, .{});
+            if (t.stats) |stats| {
+                const loc = t.tree.tokens.items(.loc)[fn_decl_loc];
+                try stats.add(.demoted_functions, fn_name, loc, t.last_fail_reason orelse format, format, .{});
+            }
             return t.addTopLevelDecl(fn_name, proto_node);
         },
     };
 
+    // Changing the parameter types changes the type of the function, which must then
+    // not be observable through a function pointer.
+    if (try t.isOnlyCalled(fn_name)) {
+        for (proto_payload.data.params, func_ty.params) |*param, param_info| {
+            if (t.isStaticArrayParam(param_info.qt) and
+                t.isOnlySubscripted(param_info.name.lookup(t.comp), function.body.?.tok(t.tree) + 1))
+            {
+                param.type = try t.manyPointerType(param.type);
+            }
+        }
+    }
+
     try t.global_scope.addMemberFunction(func_ty, proto_payload);
     proto_payload.data.body = try block_scope.complete();
     return t.addTopLevelDecl(fn_name, proto_node);
@@ -844,8 +1427,16 @@ fn transVarDecl(t: *Translator, scope: *Scope, variable: Node.Variable, decl_nod
     const base_name = t.tree.tokSlice(variable.name_tok);
     const toplevel = scope.id == .root;
     const bs: *Scope.Block = if (!toplevel) try scope.findBlockScope(t) else undefined;
+    const hoisted = !toplevel and t.hoist_static_locals and
+        variable.storage_class == .static and t.canHoistStaticLocal(scope, variable);
     const name, const use_base_name = blk: {
         if (toplevel) break :blk .{ base_name, false };
+        if (hoisted) {
+            const hoisted_name = try t.createHoistedName(scope, base_name);
+            try t.hoisted_static_locals.put(t.gpa, hoisted_name, {});
+            try bs.variables.append(t.gpa, .{ .name = base_name, .alias = hoisted_name });
+            break :blk .{ hoisted_name, false };
+        }
 
         // Local extern and static variables are wrapped in a struct.
         const prefix: ?[]const u8 = switch (variable.storage_class) {
@@ -864,7 +1455,7 @@ fn transVarDecl(t: *Translator, scope: *Scope, variable: Node.Variable, decl_nod
         }
     }
 
-    const type_node = (if (variable.initializer) |init|
+    var type_node = (if (variable.initializer) |init|
         t.transTypeInit(scope, variable.qt, init, variable.name_tok)
     else
         t.transType(scope, variable.qt, variable.name_tok)) catch |err| switch (err) {
@@ -873,6 +1464,12 @@ fn transVarDecl(t: *Translator, scope: *Scope, variable: Node.Variable, decl_nod
         },
         else => |e| return e,
     };
+    if (!toplevel and !use_base_name and variable.initializer != null and
+        t.isArrayDecay(variable.initializer.?) and t.isOnlySubscripted(base_name, variable.name_tok + 1))
+    {
+        // Initialized from an array, so never null.
+        type_node = try t.manyPointerType(type_node);
+    }
 
     const array_ty = variable.qt.get(t.comp, .array);
     var is_const = variable.qt.@"const" or (array_ty != null and array_ty.?.elem.@"const");
@@ -882,7 +1479,7 @@ fn transVarDecl(t: *Translator, scope: *Scope, variable: Node.Variable, decl_nod
     const init_node = init: {
         if (variable.initializer) |init| {
             const maybe_literal = init.get(t.tree);
-            if (!toplevel) try t.wip_var_inits.putNoClobber(t.gpa, decl_node, {});
+            if (!toplevel and !hoisted) try t.wip_var_inits.putNoClobber(t.gpa, decl_node, {});
             defer _ = t.wip_var_inits.remove(decl_node);
 
             const init_node = (if (maybe_literal == .string_literal_expr)
@@ -958,7 +1555,7 @@ fn transVarDecl(t: *Translator, scope: *Scope, variable: Node.Variable, decl_nod
         .init = init_node,
     });
 
-    if (toplevel) {
+    if (toplevel or hoisted) {
         try t.addTopLevelDecl(name, node);
     } else {
         if (use_base_name) {
@@ -1000,6 +1597,73 @@ fn transVarDecl(t: *Translator, scope: *Scope, variable: Node.Variable, decl_nod
     }
 }
 
+/// Static locals can be moved to file scope if their declaration does not refer to
+/// any local declarations other than previously hoisted static locals.
+fn canHoistStaticLocal(t: *Translator, scope: *Scope, variable: Node.Variable) bool {
+    const ids = t.tree.tokens.items(.id);
+
+    // Find the start of the declaration specifiers, skipping over the bodies of
+    // records defined in them.
+    var start = variable.name_tok;
+    var depth: usize = 0;
+    var seen_static = false;
+    while (start > 0) : (start -= 1) switch (ids[start - 1]) {
+        .r_brace => {
+            if (depth == 0 and seen_static) break;
+            depth += 1;
+        },
+        .l_brace => {
+            if (depth == 0) break;
+            depth -= 1;
+            // Types defined in the declaration are local to the function.
+            if (depth == 0) return false;
+        },
+        .semicolon => if (depth == 0) break,
+        .keyword_static => if (depth == 0) {
+            seen_static = true;
+        },
+        else => {},
+    };
+
+    var tok = start;
+    depth = 0;
+    while (tok < ids.len) : (tok += 1) switch (ids[tok]) {
+        .l_brace, .l_paren, .l_bracket => depth += 1,
+        .r_brace, .r_paren, .r_bracket => {
+            if (depth == 0) return true;
+            depth -= 1;
+        },
+        .semicolon => if (depth == 0) return true,
+        .identifier, .extended_identifier => {
+            // Member designators and member accesses.
+            if (ids[tok - 1] == .period or ids[tok - 1] == .arrow) continue;
+            const name = t.tree.tokSlice(tok);
+            const alias = switch (ids[tok - 1]) {
+                .keyword_struct, .keyword_union, .keyword_enum => blk: {
+                    var buf: [256]u8 = undefined;
+                    const tag_name = std.fmt.bufPrint(&buf, "{s}_{s}", .{ t.tree.tokSlice(tok - 1), name }) catch return false;
+                    break :blk scope.getAlias(tag_name);
+                },
+                else => scope.getAlias(name),
+            } orelse continue;
+            if (!t.hoisted_static_locals.contains(alias)) return false;
+        },
+        else => {},
+    };
+    return true;
+}
+
+/// Creates a file scope name for a hoisted static local that does not conflict
+/// with any global or with locals visible from `scope`.
+fn createHoistedName(t: *Translator, scope: *Scope, base_name: []const u8) ![]const u8 {
+    const alias_base = try std.fmt.allocPrint(t.arena, "{s}_{s}", .{ Scope.Block.static_local_prefix, base_name });
+    var name = alias_base;
+    while (t.global_scope.contains(name) or scope.getAlias(name) != null) {
+        name = try std.fmt.allocPrint(t.arena, "{s}_{d}", .{ alias_base, t.getMangle() });
+    }
+    return name;
+}
+
 fn transEnumDecl(t: *Translator, scope: *Scope, enum_qt: QualType) Error!void {
     const base = enum_qt.base(t.comp);
     const enum_ty = base.type.@"enum";
@@ -1035,7 +1699,10 @@ fn transEnumDecl(t: *Translator, scope: *Scope, enum_qt: QualType) Error!void {
             }
 
             const enum_const_type_node: ?ZigNode = t.transType(scope, field.qt, field.name_tok) catch |err| switch (err) {
-                error.UnsupportedType => null,
+                error.UnsupportedType => blk: {
+                    t.last_fail_reason = null;
+                    break :blk null;
+                },
                 else => |e| return e,
             };
 
@@ -1089,6 +1756,7 @@ fn transStaticAssert(t: *Translator, scope: *Scope, static_assert: Node.StaticAs
     const condition = t.transExpr(scope, static_assert.cond, .used) catch |err| switch (err) {
         error.SelfReferential => unreachable,
         error.UnsupportedTranslation, error.UnsupportedType => {
+            t.last_fail_reason = null;
             return try t.warn(&t.global_scope.base, static_assert.cond.tok(t.tree), "unable to translate _Static_assert condition", .{});
         },
         error.OutOfMemory => |e| return e,
@@ -1175,7 +1843,7 @@ fn transType(t: *Translator, scope: *Scope, qt: QualType, source_loc: TokenIndex
             .double, .float64, .float32x => return ZigTag.type.create(t.arena, "f64"),
             .long_double, .float64x => return ZigTag.type.create(t.arena, "c_longdouble"),
             .float128 => return ZigTag.type.create(t.arena, "f128"),
-            .bf16 => return t.fail(error.UnsupportedType, source_loc, "TODO support bfloat16", .{}),
+            .bf16 => return t.createHelperCallNode(.BFloat16, null),
             .dfloat32,
             .dfloat64,
             .dfloat128,
@@ -1404,7 +2072,7 @@ fn transFnType(
 
     for (func_ty.params, fn_params) |param_info, *param_node| {
         const param_qt = param_info.qt;
-        const is_noalias = param_qt.restrict;
+        const is_noalias = t.isRestrict(param_qt);
 
         const param_name: ?[]const u8 = if (param_info.name == .empty)
             null
@@ -1550,6 +2218,369 @@ fn typeIsOpaque(t: *Translator, qt: QualType) bool {
     };
 }
 
+/// Returns true if `qt` is restrict qualified, including through typedefs.
+/// Zig only allows `noalias` on parameters, so this is only used for them.
+fn isRestrict(t: *Translator, qt: QualType) bool {
+    var cur = qt;
+    while (true) {
+        if (cur.restrict) return true;
+        cur = switch (cur.type(t.comp)) {
+            .typedef => |typedef_ty| typedef_ty.base,
+            .attributed => |attributed_ty| attributed_ty.base,
+            .typeof => |typeof_ty| typeof_ty.base,
+            else => return false,
+        };
+    }
+}
+
+/// C99 `T param[static N]` parameters must point to at least N elements, so they are never null.
+fn isStaticArrayParam(t: *Translator, qt: QualType) bool {
+    const pointer_ty = qt.get(t.comp, .pointer) orelse return false;
+    const decayed_qt = pointer_ty.decayed orelse return false;
+    const array_ty = decayed_qt.get(t.comp, .array) orelse return false;
+    return array_ty.len == .static;
+}
+
+/// Returns true if `expr` is an array, other than a string literal, decayed to a pointer.
+fn isArrayDecay(t: *Translator, expr: Node.Index) bool {
+    const cast = switch (expr.get(t.tree)) {
+        .cast => |cast| cast,
+        else => return false,
+    };
+    if (cast.kind != .array_to_pointer) return false;
+    return loop: switch (cast.operand.get(t.tree)) {
+        .paren_expr => |paren_expr| continue :loop paren_expr.operand.get(t.tree),
+        .decl_ref_expr, .member_access_expr, .member_access_ptr_expr, .array_access_expr => true,
+        else => false,
+    };
+}
+
+/// Returns true if every use of `name` from `start_tok` to the end of the enclosing
+/// block is the base of a subscript. Such a pointer that is known to be non-null
+/// never needs the null semantics of `[*c]T` and can be translated as `[*]T`.
+fn isOnlySubscripted(t: *Translator, name: []const u8, start_tok: TokenIndex) bool {
+    const ids = t.tree.tokens.items(.id);
+    var depth: usize = 0;
+    var tok = start_tok;
+    while (tok < ids.len) : (tok += 1) switch (ids[tok]) {
+        .l_brace => depth += 1,
+        .r_brace => {
+            if (depth == 0) return true;
+            depth -= 1;
+        },
+        .identifier, .extended_identifier => {
+            if (!mem.eql(u8, t.tree.tokSlice(tok), name)) continue;
+            // A member with the same name.
+            if (ids[tok - 1] == .period or ids[tok - 1] == .arrow) continue;
+            if (tok + 1 == ids.len or ids[tok + 1] != .l_bracket) return false;
+        },
+        else => {},
+    };
+    return true;
+}
+
+/// Returns true if every reference to the function `name` is a direct call, so that
+/// its type is never observed.
+fn isOnlyCalled(t: *Translator, name: []const u8) !bool {
+    if (!t.non_call_refs_populated) {
+        t.non_call_refs_populated = true;
+        const ids = t.tree.tokens.items(.id);
+        for (ids, 0..) |id, i| {
+            if (id != .identifier and id != .extended_identifier) continue;
+            if (i + 1 < ids.len and ids[i + 1] == .l_paren) continue;
+            try t.non_call_refs.put(t.gpa, t.tree.tokSlice(@intCast(i)), {});
+        }
+        try t.findRecursiveInlineFns();
+    }
+    return !t.non_call_refs.contains(name);
+}
+
+/// Returns true if the function `name` is only called and is not part of a cycle of
+/// calls between `static inline` functions, so that it can be translated as an inline fn.
+fn isInlinable(t: *Translator, name: []const u8) !bool {
+    return try t.isOnlyCalled(name) and !t.recursive_inline_fns.contains(name);
+}
+
+/// Finds the strongly connected components of the call graph of the `static inline`
+/// function definitions and adds every function in a cycle to `recursive_inline_fns`.
+fn findRecursiveInlineFns(t: *Translator) !void {
+    var arena_instance = std.heap.ArenaAllocator.init(t.gpa);
+    defer arena_instance.deinit();
+    const arena = arena_instance.allocator();
+
+    var fns: std.StringArrayHashMapUnmanaged(Node.Index) = .empty;
+    for (t.tree.root_decls.items) |decl| switch (decl.get(t.tree)) {
+        .function => |function| {
+            const body = function.body orelse continue;
+            if (!function.static or !function.@"inline") continue;
+            try fns.put(arena, t.tree.tokSlice(function.name_tok), body);
+        },
+        else => {},
+    };
+
+    const callees = try arena.alloc(std.ArrayList(u32), fns.count());
+    for (callees, fns.values()) |*list, body| {
+        list.* = .empty;
+        const ids = t.tree.tokens.items(.id);
+        var depth: usize = 0;
+        var tok = body.tok(t.tree);
+        while (tok < ids.len) : (tok += 1) switch (ids[tok]) {
+            .l_brace => depth += 1,
+            .r_brace => {
+                depth -= 1;
+                if (depth == 0) break;
+            },
+            .identifier, .extended_identifier => {
+                if (ids[tok - 1] == .period or ids[tok - 1] == .arrow) continue;
+                if (tok + 1 == ids.len or ids[tok + 1] != .l_paren) continue;
+                const callee = fns.getIndex(t.tree.tokSlice(tok)) orelse continue;
+                try list.append(arena, @intCast(callee));
+            },
+            else => {},
+        };
+    }
+
+    // Tarjan's algorithm.
+    const Scc = struct {
+        callees: []const std.ArrayList(u32),
+        index: []u32,
+        lowlink: []u32,
+        on_stack: []bool,
+        stack: std.ArrayList(u32) = .empty,
+        next_index: u32 = 0,
+        recursive: []bool,
+
+        const unvisited = std.math.maxInt(u32);
+
+        fn visit(scc: *@This(), gpa: mem.Allocator, v: u32) !void {
+            scc.index[v] = scc.next_index;
+            scc.lowlink[v] = scc.next_index;
+            scc.next_index += 1;
+            try scc.stack.append(gpa, v);
+            scc.on_stack[v] = true;
+
+            var self_call = false;
+            for (scc.callees[v].items) |w| {
+                if (w == v) self_call = true;
+                if (scc.index[w] == unvisited) {
+                    try scc.visit(gpa, w);
+                    scc.lowlink[v] = @min(scc.lowlink[v], scc.lowlink[w]);
+                } else if (scc.on_stack[w]) {
+                    scc.lowlink[v] = @min(scc.lowlink[v], scc.index[w]);
+                }
+            }
+            if (scc.lowlink[v] != scc.index[v]) return;
+
+            const top = scc.stack.items.len;
+            var start = top;
+            while (true) {
+                start -= 1;
+                const w = scc.stack.items[start];
+                scc.on_stack[w] = false;
+                if (w == v) break;
+            }
+            if (top - start > 1 or self_call) {
+                for (scc.stack.items[start..]) |w| scc.recursive[w] = true;
+            }
+            scc.stack.items.len = start;
+        }
+    };
+    var scc: Scc = .{
+        .callees = callees,
+        .index = try arena.alloc(u32, fns.count()),
+        .lowlink = try arena.alloc(u32, fns.count()),
+        .on_stack = try arena.alloc(bool, fns.count()),
+        .recursive = try arena.alloc(bool, fns.count()),
+    };
+    @memset(scc.index, Scc.unvisited);
+    @memset(scc.on_stack, false);
+    @memset(scc.recursive, false);
+    for (0..fns.count()) |v| {
+        if (scc.index[v] == Scc.unvisited) try scc.visit(arena, @intCast(v));
+    }
+
+    for (fns.keys(), scc.recursive) |name, recursive| {
+        if (recursive) try t.recursive_inline_fns.put(t.gpa, name, {});
+    }
+}
+
+/// Converts a `[*c]T` type to `[*]T`, other types are returned unchanged.
+fn manyPointerType(t: *Translator, type_node: ZigNode) !ZigNode {
+    const c_pointer = type_node.castTag(.c_pointer) orelse return type_node;
+    return ZigTag.many_pointer.create(t.arena, c_pointer.data);
+}
+
+/// Returns the declaration referenced by `expr` if it is a plain reference to a variable,
+/// looking through parentheses and value preserving implicit casts.
+fn referencedDecl(t: *Translator, expr: Node.Index) ?Node.Index {
+    return loop: switch (expr.get(t.tree)) {
+        .paren_expr => |paren_expr| continue :loop paren_expr.operand.get(t.tree),
+        .cast => |cast| switch (cast.kind) {
+            .lval_to_rval, .no_op => continue :loop cast.operand.get(t.tree),
+            .int_cast => if (cast.implicit and
+                cast.qt.bitSizeof(t.comp) >= cast.operand.qt(t.tree).bitSizeof(t.comp))
+                continue :loop cast.operand.get(t.tree)
+            else
+                null,
+            else => null,
+        },
+        .decl_ref_expr => |decl_ref| decl_ref.decl,
+        else => null,
+    };
+}
+
+/// Returns true if `expr` is a non-negative integer constant or a reference
+/// to a variable in `nonnegative_locals`.
+fn isNonNegative(t: *Translator, expr: Node.Index) bool {
+    if (t.tree.value_map.get(expr)) |val| return val.compare(.gte, .zero, t.comp);
+    const decl = t.referencedDecl(expr) orelse return false;
+    return t.nonnegative_locals.contains(decl);
+}
+
+/// Marks the variables compared in a loop condition that never hold a negative value.
+fn markInductionVars(t: *Translator, cond: Node.Index) Error!void {
+    loop: switch (cond.get(t.tree)) {
+        .paren_expr => |paren_expr| continue :loop paren_expr.operand.get(t.tree),
+        .bool_and_expr => |bool_and| {
+            try t.markInductionVars(bool_and.lhs);
+            continue :loop bool_and.rhs.get(t.tree);
+        },
+        .less_than_expr,
+        .less_than_equal_expr,
+        .greater_than_expr,
+        .greater_than_equal_expr,
+        .equal_expr,
+        .not_equal_expr,
+        => |cmp| {
+            if (t.referencedDecl(cmp.lhs)) |decl| try t.markNonNegativeLocal(decl, null);
+            if (t.referencedDecl(cmp.rhs)) |decl| try t.markNonNegativeLocal(decl, null);
+        },
+        else => {},
+    }
+}
+
+/// Adds `decl` to `nonnegative_locals` if it is a local signed integer variable that
+/// can never hold a negative value from its declaration to `end_tok`, or to the end
+/// of the enclosing block if null. This is the case if it is initialized and assigned
+/// only with non-negative literals and otherwise only incremented; signed overflow is
+/// undefined behavior so the increments cannot make it negative.
+fn markNonNegativeLocal(t: *Translator, decl: Node.Index, end_tok: ?TokenIndex) Error!void {
+    if (t.nonnegative_locals.contains(decl)) return;
+    const variable = switch (decl.get(t.tree)) {
+        .variable => |variable| variable,
+        else => return,
+    };
+    if (variable.storage_class == .@"extern" or variable.qt.@"volatile") return;
+    if (variable.qt.is(t.comp, .vector) or t.signedness(variable.qt) != .signed) return;
+    if (variable.initializer) |init| {
+        const val = t.tree.value_map.get(init) orelse return;
+        if (val.compare(.lt, .zero, t.comp)) return;
+    }
+
+    const ids = t.tree.tokens.items(.id);
+    const name = t.tree.tokSlice(variable.name_tok);
+    const bits = variable.qt.bitSizeof(t.comp);
+    var depth: usize = 0;
+    var tok = variable.name_tok + 1;
+    while (true) : (tok += 1) {
+        // Global variables may be modified by other functions.
+        if (tok == ids.len) return;
+        if (end_tok) |end| if (tok > end) break;
+        switch (ids[tok]) {
+            .l_brace => depth += 1,
+            .r_brace => {
+                if (depth == 0) break;
+                depth -= 1;
+            },
+            .identifier, .extended_identifier => {
+                if (!mem.eql(u8, t.tree.tokSlice(tok), name)) continue;
+                // A member with the same name.
+                if (ids[tok - 1] == .period or ids[tok - 1] == .arrow) continue;
+                if (!t.isNonNegativeUse(tok, bits)) return;
+            },
+            else => {},
+        }
+    }
+    try t.nonnegative_locals.put(t.gpa, decl, {});
+}
+
+/// Returns false if the use of a variable at `tok` may store a negative value
+/// in it or may let it be modified through a pointer.
+fn isNonNegativeUse(t: *Translator, tok: TokenIndex, bits: u64) bool {
+    const ids = t.tree.tokens.items(.id);
+    // `(i) = -1` also assigns to `i`.
+    var prev = tok - 1;
+    while (ids[prev] == .l_paren) prev -= 1;
+    var next = tok + 1;
+    while (ids[next] == .r_paren) next += 1;
+
+    switch (ids[prev]) {
+        .ampersand, .minus_minus => return false,
+        else => {},
+    }
+    switch (ids[next]) {
+        .equal, .plus_equal => {
+            const literal = next + 1;
+            if (!t.isNonNegativeLiteral(literal, bits)) return false;
+            return switch (ids[literal + 1]) {
+                .semicolon, .comma, .r_paren => true,
+                else => false,
+            };
+        },
+        .minus_minus,
+        .minus_equal,
+        .asterisk_equal,
+        .slash_equal,
+        .percent_equal,
+        .ampersand_equal,
+        .pipe_equal,
+        .caret_equal,
+        .angle_bracket_angle_bracket_left_equal,
+        .angle_bracket_angle_bracket_right_equal,
+        => return false,
+        else => return true,
+    }
+}
+
+/// Returns true if `tok` is an integer literal representable by a signed integer with `bits` bits.
+fn isNonNegativeLiteral(t: *Translator, tok: TokenIndex, bits: u64) bool {
+    const slice = mem.trimEnd(u8, t.tree.tokSlice(tok), "uUlL");
+    if (slice.len == 0 or !std.ascii.isDigit(slice[0])) return false;
+    const value = std.fmt.parseInt(u64, slice, 0) catch return false;
+    return bits > 64 or value < @as(u64, 1) << @intCast(bits - 1);
+}
+
+/// Returns the last token of the `for` or `while` statement starting at `loop_tok`,
+/// or null if its body cannot be delimited with a simple token scan.
+fn loopEndTok(t: *Translator, loop_tok: TokenIndex) ?TokenIndex {
+    const ids = t.tree.tokens.items(.id);
+    var depth: usize = 0;
+    var tok = loop_tok + 1;
+    // Skip the loop header.
+    while (tok < ids.len) : (tok += 1) switch (ids[tok]) {
+        .l_paren => depth += 1,
+        .r_paren => {
+            depth -= 1;
+            if (depth == 0) break;
+        },
+        else => {},
+    };
+    tok += 1;
+    const is_block = tok < ids.len and ids[tok] == .l_brace;
+    while (tok < ids.len) : (tok += 1) switch (ids[tok]) {
+        .l_paren, .l_bracket, .l_brace => depth += 1,
+        .r_paren, .r_bracket => depth -= 1,
+        .r_brace => {
+            depth -= 1;
+            if (depth == 0 and is_block) return tok;
+        },
+        .semicolon => if (depth == 0 and !is_block) return tok,
+        .keyword_if, .keyword_for, .keyword_while, .keyword_do, .keyword_switch => if (depth == 0) return null,
+        else => {},
+    };
+    return null;
+}
+
 fn typeWasDemotedToOpaque(t: *Translator, qt: QualType) bool {
     return t.opaque_demotes.contains(qt);
 }
@@ -1566,10 +2597,12 @@ fn typeHasWrappingOverflow(t: *Translator, qt: QualType) bool {
 
 /// Signedness of type when translated to Zig.
 /// Different from `QualType.signedness()` for `char` and enums.
+/// Vectors have the signedness of their element type.
 /// Returns null for non-int types.
 fn signedness(t: *Translator, qt: QualType) ?std.builtin.Signedness {
     return loop: switch (qt.base(t.comp).type) {
         .bool => .unsigned,
+        .vector => |vector_ty| continue :loop vector_ty.elem.base(t.comp).type,
         .bit_int => |bit_int| bit_int.signedness,
         .int => |int_ty| switch (int_ty) {
             .char => .unsigned, // Always translated as u8
@@ -1602,7 +2635,7 @@ fn transStmt(t: *Translator, scope: *Scope, stmt: Node.Index) TransError!ZigNode
         .if_stmt => |if_stmt| return t.transIfStmt(scope, if_stmt),
         .while_stmt => |while_stmt| return t.transWhileStmt(scope, while_stmt),
         .do_while_stmt => |do_while_stmt| return t.transDoWhileStmt(scope, do_while_stmt),
-        .for_stmt => |for_stmt| return t.transForStmt(scope, for_stmt),
+        .for_stmt => |for_stmt| return t.transForStmt(scope, for_stmt, stmt.tok(t.tree)),
         .continue_stmt => return ZigTag.@"continue".init(),
         .break_stmt => return ZigTag.@"break".init(),
         .typedef => |typedef_decl| {
@@ -1722,7 +2755,8 @@ fn transIfStmt(t: *Translator, scope: *Scope, if_stmt: Node.IfStmt) TransError!Z
         },
     };
     defer cond_scope.deinit();
-    const cond = try t.transBoolExpr(&cond_scope.base, if_stmt.cond);
+    const expected = t.expectedCond(if_stmt.cond);
+    const cond = try t.transBoolExpr(&cond_scope.base, if (expected) |some| some.cond else if_stmt.cond);
 
     // block needed to keep else statement from attaching to inner while
     const must_blockify = (if_stmt.else_body != null) and switch (if_stmt.then_body.get(t.tree)) {
@@ -1730,10 +2764,11 @@ fn transIfStmt(t: *Translator, scope: *Scope, if_stmt: Node.IfStmt) TransError!Z
         else => false,
     };
 
-    const then_node = if (must_blockify)
+    var then_node = if (must_blockify)
         try t.blockify(scope, if_stmt.then_body)
     else
         try t.maybeBlockify(scope, if_stmt.then_body);
+    if (expected) |some| then_node = try t.addBranchHint(then_node, some.hint);
 
     const else_node = if (if_stmt.else_body) |stmt|
         try t.maybeBlockify(scope, stmt)
@@ -1742,7 +2777,82 @@ fn transIfStmt(t: *Translator, scope: *Scope, if_stmt: Node.IfStmt) TransError!Z
     return ZigTag.@"if".create(t.arena, .{ .cond = cond, .then = then_node, .@"else" = else_node });
 }
 
+const ExpectedCond = struct {
+    /// The condition with the `__builtin_expect` call stripped.
+    cond: Node.Index,
+    /// The hint to place in the branch taken when `cond` is true.
+    hint: []const u8,
+};
+
+/// If `cond` is a `__builtin_expect(expr, c)` call with a constant expected
+/// value, returns `expr` and the branch hint it implies.
+fn expectedCond(t: *Translator, cond: Node.Index) ?ExpectedCond {
+    const call = loop: switch (cond.get(t.tree)) {
+        .paren_expr => |paren_expr| continue :loop paren_expr.operand.get(t.tree),
+        .cast => |cast| {
+            if (!cast.implicit) return null;
+            continue :loop cast.operand.get(t.tree);
+        },
+        .builtin_call_expr => |call| break :loop call,
+        else => return null,
+    };
+    if (!mem.eql(u8, t.tree.tokSlice(call.builtin_tok), "__builtin_expect")) return null;
+    const expected_val = t.tree.value_map.get(call.args[1]) orelse return null;
+
+    // Skip the implicit conversion to `long` so that `__builtin_expect(!!x, 1)`
+    // translates the same as `if (x)`. A narrowing conversion may turn a nonzero
+    // value into zero, so it is kept.
+    var expr = call.args[0];
+    while (true) switch (expr.get(t.tree)) {
+        .cast => |cast| {
+            if (!cast.implicit or cast.kind != .int_cast) break;
+            if (cast.qt.bitSizeof(t.comp) < cast.operand.qt(t.tree).bitSizeof(t.comp)) break;
+            expr = cast.operand;
+        },
+        else => break,
+    };
+    return .{
+        .cond = expr,
+        .hint = if (expected_val.isZero(t.comp)) "unlikely" else "likely",
+    };
+}
+
+fn createBranchHintNode(t: *Translator, hint: []const u8) !ZigNode {
+    return ZigTag.branch_hint.create(t.arena, try ZigTag.enum_literal.create(t.arena, hint));
+}
+
+/// Prepends `@branchHint(hint)` to a branch body, placing the body in a block if needed.
+fn addBranchHint(t: *Translator, body: ZigNode, hint: []const u8) !ZigNode {
+    const hint_node = try t.createBranchHintNode(hint);
+    switch (body.tag()) {
+        .empty_block => return ZigTag.block_single.create(t.arena, hint_node),
+        .block_single => {
+            const stmt = body.castTag(.block_single).?.data;
+            return ZigTag.block.create(t.arena, .{
+                .label = null,
+                .stmts = try t.arena.dupe(ZigNode, &.{ hint_node, stmt }),
+            });
+        },
+        .block => {
+            const block = body.castTag(.block).?.data;
+            if (block.label == null) {
+                const stmts = try t.arena.alloc(ZigNode, block.stmts.len + 1);
+                stmts[0] = hint_node;
+                @memcpy(stmts[1..], block.stmts);
+                return ZigTag.block.create(t.arena, .{ .label = null, .stmts = stmts });
+            }
+        },
+        else => {},
+    }
+    return ZigTag.block.create(t.arena, .{
+        .label = null,
+        .stmts = try t.arena.dupe(ZigNode, &.{ hint_node, body }),
+    });
+}
+
 fn transWhileStmt(t: *Translator, scope: *Scope, while_stmt: Node.WhileStmt) TransError!ZigNode {
+    try t.markInductionVars(while_stmt.cond);
+
     var cond_scope: Scope.Condition = .{
         .base = .{
             .parent = scope,
@@ -1818,7 +2928,7 @@ fn transDoWhileStmt(t: *Translator, scope: *Scope, do_stmt: Node.DoWhileStmt) Tr
     return ZigTag.while_true.create(t.arena, body_node);
 }
 
-fn transForStmt(t: *Translator, scope: *Scope, for_stmt: Node.ForStmt) TransError!ZigNode {
+fn transForStmt(t: *Translator, scope: *Scope, for_stmt: Node.ForStmt, for_tok: TokenIndex) TransError!ZigNode {
     var loop_scope: Scope = .{
         .parent = scope,
         .id = .loop,
@@ -1834,14 +2944,26 @@ fn transForStmt(t: *Translator, scope: *Scope, for_stmt: Node.ForStmt) TransErro
             for (decls) |decl| {
                 try t.transDecl(&block_scope.?.base, decl);
             }
+            // Variables declared in the loop header go out of scope at the end of the loop.
+            const for_end = t.loopEndTok(for_tok);
+            for (decls) |decl| {
+                try t.markNonNegativeLocal(decl, for_end);
+            }
         },
         .expr => |maybe_init| if (maybe_init) |init| {
             block_scope = try Scope.Block.init(t, scope, false);
             loop_scope.parent = &block_scope.?.base;
             const init_node = try t.transStmt(&block_scope.?.base, init);
             try loop_scope.appendNode(init_node);
+
+            if (init.get(t.tree) == .assign_expr) {
+                if (t.referencedDecl(init.get(t.tree).assign_expr.lhs)) |decl| {
+                    try t.markNonNegativeLocal(decl, null);
+                }
+            }
         },
     }
+    if (for_stmt.cond) |cond| try t.markInductionVars(cond);
     var cond_scope: Scope.Condition = .{
         .base = .{
             .parent = &loop_scope,
@@ -1880,6 +3002,7 @@ fn transSwitch(t: *Translator, scope: *Scope, switch_stmt: Node.SwitchStmt) Tran
     defer block_scope.deinit();
 
     const base_scope = &block_scope.base;
+    const switch_label = try block_scope.makeMangledName("sw");
 
     var cond_scope: Scope.Condition = .{
         .base = .{
@@ -1890,53 +3013,72 @@ fn transSwitch(t: *Translator, scope: *Scope, switch_stmt: Node.SwitchStmt) Tran
     defer cond_scope.deinit();
     const switch_expr = try t.transExpr(&cond_scope.base, switch_stmt.cond, .used);
 
-    var cases: std.ArrayList(ZigNode) = .empty;
-    defer cases.deinit(t.gpa);
-    var has_default = false;
+    // A switch body that is not a compound statement is a single statement,
+    // usually a case whose body is the rest of the switch.
+    const single_body = [1]Node.Index{switch_stmt.body};
+    const body: []const Node.Index = switch (switch_stmt.body.get(t.tree)) {
+        .compound_stmt => |compound| compound.body,
+        else => &single_body,
+    };
 
-    const body_node = switch_stmt.body.get(t.tree);
-    if (body_node != .compound_stmt) {
-        return t.fail(error.UnsupportedTranslation, switch_stmt.switch_tok, "TODO complex switch", .{});
-    }
-    const body = body_node.compound_stmt.body;
-    // Iterate over switch body and collect all cases.
-    // Fallthrough is handled by duplicating statements.
+    // Collect the items of every prong first so that a prong can
+    // fall through to the next one with `continue :sw item`.
+    var prongs: std.ArrayList(SwitchProng) = .empty;
+    defer prongs.deinit(t.gpa);
     for (body, 0..) |stmt, i| {
         switch (stmt.get(t.tree)) {
-            .case_stmt => {
+            .case_stmt, .default_stmt => {
                 var items: std.ArrayList(ZigNode) = .empty;
                 defer items.deinit(t.gpa);
-                const sub = try t.transCaseStmt(base_scope, stmt, &items);
-                const res = try t.transSwitchProngStmt(base_scope, sub, body[i..]);
-
-                if (items.items.len == 0) {
-                    has_default = true;
-                    const switch_else = try ZigTag.switch_else.create(t.arena, res);
-                    try cases.append(t.gpa, switch_else);
-                } else {
-                    const switch_prong = try ZigTag.switch_prong.create(t.arena, .{
-                        .cases = try t.arena.dupe(ZigNode, items.items),
-                        .cond = res,
-                    });
-                    try cases.append(t.gpa, switch_prong);
-                }
+                _ = try t.transCaseStmt(base_scope, stmt, &items);
+                try prongs.append(t.gpa, .{
+                    .start = i,
+                    .items = try t.arena.dupe(ZigNode, items.items),
+                });
             },
-            .default_stmt => |default_stmt| {
-                has_default = true;
-
-                var sub = default_stmt.body;
-                while (true) switch (sub.get(t.tree)) {
-                    .case_stmt => |sub_case| sub = sub_case.body,
-                    .default_stmt => |sub_default| sub = sub_default.body,
-                    else => break,
-                };
+            else => {}, // collected in transSwitchProngStmtInline
+        }
+    }
 
-                const res = try t.transSwitchProngStmt(base_scope, sub, body[i..]);
+    var cases: std.ArrayList(ZigNode) = .empty;
+    defer cases.deinit(t.gpa);
+    var has_default = false;
+    var uses_label = false;
+
+    for (prongs.items, 0..) |prong, prong_index| {
+        var prong_scope = try Scope.Block.init(t, base_scope, false);
+        defer prong_scope.deinit();
+
+        // Fallthrough continues the labeled switch with an item of the next prong.
+        // The default prong has no item to continue with, so its statements are
+        // translated again in the prong falling into it.
+        var next_index = prong_index;
+        while (try t.transSwitchProngStmtInline(&prong_scope, body[prongs.items[next_index].start..prongEnd(prongs.items, next_index, body.len)])) {
+            next_index += 1;
+            if (next_index == prongs.items.len) break;
+            const next = prongs.items[next_index];
+            if (next.items.len != 0) {
+                uses_label = true;
+                const continue_node = try ZigTag.continue_val.create(t.arena, .{
+                    .label = switch_label,
+                    .val = if (next.items[0].castTag(.ellipsis3)) |range| range.data.lhs else next.items[0],
+                });
+                try prong_scope.statements.append(t.gpa, continue_node);
+                break;
+            }
+        }
+        const res = try prong_scope.complete();
 
-                const switch_else = try ZigTag.switch_else.create(t.arena, res);
-                try cases.append(t.gpa, switch_else);
-            },
-            else => {}, // collected in transSwitchProngStmt
+        if (prong.items.len == 0) {
+            has_default = true;
+            const switch_else = try ZigTag.switch_else.create(t.arena, res);
+            try cases.append(t.gpa, switch_else);
+        } else {
+            const switch_prong = try ZigTag.switch_prong.create(t.arena, .{
+                .cases = prong.items,
+                .cond = res,
+            });
+            try cases.append(t.gpa, switch_prong);
         }
     }
 
@@ -1946,6 +3088,7 @@ fn transSwitch(t: *Translator, scope: *Scope, switch_stmt: Node.SwitchStmt) Tran
     }
 
     const switch_node = try ZigTag.@"switch".create(t.arena, .{
+        .label = if (uses_label) switch_label else null,
         .cond = switch_expr,
         .cases = try t.arena.dupe(ZigNode, cases.items),
     });
@@ -1956,6 +3099,17 @@ fn transSwitch(t: *Translator, scope: *Scope, switch_stmt: Node.SwitchStmt) Tran
     return ZigTag.while_true.create(t.arena, while_body);
 }
 
+const SwitchProng = struct {
+    /// Index of the first case or default label of the prong in the switch body.
+    start: usize,
+    /// Empty for the default prong.
+    items: []ZigNode,
+};
+
+fn prongEnd(prongs: []const SwitchProng, index: usize, body_len: usize) usize {
+    return if (index + 1 < prongs.len) prongs[index + 1].start else body_len;
+}
+
 /// Collects all items for this case, returns the first statement after the labels.
 /// If items ends up empty, the prong should be translated as an else.
 fn transCaseStmt(
@@ -1995,49 +3149,17 @@ fn transCaseStmt(
     }
 }
 
-/// Collects all statements seen by this case into a block.
-/// Avoids creating a block if the first statement is a break or return.
-fn transSwitchProngStmt(
-    t: *Translator,
-    scope: *Scope,
-    stmt: Node.Index,
-    body: []const Node.Index,
-) TransError!ZigNode {
-    switch (stmt.get(t.tree)) {
-        .case_stmt, .default_stmt => unreachable,
-        else => {
-            var block_scope = try Scope.Block.init(t, scope, false);
-            defer block_scope.deinit();
-
-            // we do not need to translate `stmt` since it is the first stmt of `body`
-            try t.transSwitchProngStmtInline(&block_scope, body);
-            return try block_scope.complete();
-        },
-    }
-}
-
-/// Collects all statements seen by this case into a block.
+/// Collects the statements of a single prong into a block.
+/// Returns true if control can fall through to the next prong.
 fn transSwitchProngStmtInline(
     t: *Translator,
     block: *Scope.Block,
     body: []const Node.Index,
-) TransError!void {
+) TransError!bool {
     for (body) |stmt| {
         switch (stmt.get(t.tree)) {
-            .case_stmt => |case_stmt| {
-                var sub = case_stmt.body;
-                while (true) switch (sub.get(t.tree)) {
-                    .case_stmt => |sub_case| sub = sub_case.body,
-                    .default_stmt => |sub_default| sub = sub_default.body,
-                    else => break,
-                };
-                const result = try t.transStmt(&block.base, sub);
-                assert(result.tag() != .declaration);
-                try block.statements.append(t.gpa, result);
-                if (result.isNoreturn()) return;
-            },
-            .default_stmt => |default_stmt| {
-                var sub = default_stmt.body;
+            .case_stmt, .default_stmt => {
+                var sub = stmt;
                 while (true) switch (sub.get(t.tree)) {
                     .case_stmt => |sub_case| sub = sub_case.body,
                     .default_stmt => |sub_default| sub = sub_default.body,
@@ -2046,7 +3168,7 @@ fn transSwitchProngStmtInline(
                 const result = try t.transStmt(&block.base, sub);
                 assert(result.tag() != .declaration);
                 try block.statements.append(t.gpa, result);
-                if (result.isNoreturn()) return;
+                if (result.isNoreturn()) return false;
             },
             else => {
                 const result = try t.transStmt(&block.base, stmt);
@@ -2054,12 +3176,13 @@ fn transSwitchProngStmtInline(
                     .declaration, .empty_block => {},
                     else => {
                         try block.statements.append(t.gpa, result);
-                        if (result.isNoreturn()) return;
+                        if (result.isNoreturn()) return false;
                     },
                 }
             },
         }
     }
+    return true;
 }
 
 // ======================
@@ -2092,7 +3215,11 @@ fn transExpr(t: *Translator, scope: *Scope, expr: Node.Index, used: ResultUsed)
         .plus_expr => |plus_expr| return t.transExpr(scope, plus_expr.operand, used),
         .negate_expr => |negate_expr| res: {
             const operand_qt = negate_expr.operand.qt(t.tree);
-            if (!t.typeHasWrappingOverflow(operand_qt)) {
+            if (t.isBf16(operand_qt)) {
+                const operand = try t.transExpr(scope, negate_expr.operand, .used);
+                const negated = try ZigTag.negate.create(t.arena, try t.bf16ToF32(operand));
+                break :res try t.createHelperCallNode(.floatToBf16, &.{negated});
+            } else if (!t.typeHasWrappingOverflow(operand_qt)) {
                 const sub_expr_node = try t.transExpr(scope, negate_expr.operand, .used);
                 const to_negate = if (sub_expr_node.isBoolRes()) blk: {
                     const ty_node = try ZigTag.type.create(t.arena, "c_int");
@@ -2107,7 +3234,7 @@ fn transExpr(t: *Translator, scope: *Scope, expr: Node.Index, used: ResultUsed)
             } else return t.fail(error.UnsupportedTranslation, negate_expr.op_tok, "C negation with non float non integer", .{});
         },
         .div_expr => |div_expr| res: {
-            if (qt.isInt(t.comp) and t.signedness(qt) == .signed) {
+            if (t.signedness(qt) == .signed) {
                 // signed integer division uses @divTrunc
                 const lhs = try t.transExpr(scope, div_expr.lhs, .used);
                 const rhs = try t.transExpr(scope, div_expr.rhs, .used);
@@ -2117,10 +3244,15 @@ fn transExpr(t: *Translator, scope: *Scope, expr: Node.Index, used: ResultUsed)
             break :res try t.transBinExpr(scope, div_expr, .div);
         },
         .mod_expr => |mod_expr| res: {
-            if (qt.isInt(t.comp) and t.signedness(qt) == .signed) {
-                // signed integer remainder uses __helpers.signedRemainder
+            if (t.signedness(qt) == .signed) {
                 const lhs = try t.transExpr(scope, mod_expr.lhs, .used);
                 const rhs = try t.transExpr(scope, mod_expr.rhs, .used);
+                if (qt.is(t.comp, .vector) or t.isNonNegative(mod_expr.rhs)) {
+                    // @rem truncates like C; with a denominator that is not negative
+                    // (zero is undefined behavior in C) no check of its sign is needed.
+                    break :res try ZigTag.rem.create(t.arena, .{ .lhs = lhs, .rhs = rhs });
+                }
+                // other signed integer remainders use __helpers.signedRemainder
                 break :res try t.createHelperCallNode(.signedRemainder, &.{ lhs, rhs });
             }
             // unsigned/float division uses the operator
@@ -2165,12 +3297,12 @@ fn transExpr(t: *Translator, scope: *Scope, expr: Node.Index, used: ResultUsed)
         else
             try t.transBinExpr(scope, mul_expr, .mul),
 
-        .less_than_expr => |lt| try t.transBinExpr(scope, lt, .less_than),
-        .greater_than_expr => |gt| try t.transBinExpr(scope, gt, .greater_than),
-        .less_than_equal_expr => |lte| try t.transBinExpr(scope, lte, .less_than_equal),
-        .greater_than_equal_expr => |gte| try t.transBinExpr(scope, gte, .greater_than_equal),
-        .equal_expr => |equal_expr| try t.transBinExpr(scope, equal_expr, .equal),
-        .not_equal_expr => |not_equal_expr| try t.transBinExpr(scope, not_equal_expr, .not_equal),
+        .less_than_expr => |lt| try t.transCmpExpr(scope, lt, .less_than),
+        .greater_than_expr => |gt| try t.transCmpExpr(scope, gt, .greater_than),
+        .less_than_equal_expr => |lte| try t.transCmpExpr(scope, lte, .less_than_equal),
+        .greater_than_equal_expr => |gte| try t.transCmpExpr(scope, gte, .greater_than_equal),
+        .equal_expr => |equal_expr| try t.transCmpExpr(scope, equal_expr, .equal),
+        .not_equal_expr => |not_equal_expr| try t.transCmpExpr(scope, not_equal_expr, .not_equal),
 
         .bool_and_expr => |bool_and_expr| try t.transBoolBinExpr(scope, bool_and_expr, .@"and"),
         .bool_or_expr => |bool_or_expr| try t.transBoolBinExpr(scope, bool_or_expr, .@"or"),
@@ -2490,7 +3622,10 @@ fn transCastExpr(
             return t.maybeSuppressResult(used, cmp_node);
         },
         .float_to_bool => {
-            const sub_expr_node = try t.transExpr(scope, cast.operand, .used);
+            var sub_expr_node = try t.transExpr(scope, cast.operand, .used);
+            if (t.isBf16(cast.operand.qt(t.tree))) {
+                sub_expr_node = try t.bf16ToF32(sub_expr_node);
+            }
             const cmp_node = try ZigTag.not_equal.create(t.arena, .{ .lhs = sub_expr_node, .rhs = ZigTag.zero_literal.init() });
             return t.maybeSuppressResult(used, cmp_node);
         },
@@ -2518,6 +3653,7 @@ fn transCastExpr(
         .bool_to_float => bool_to_float: {
             const sub_expr_node = try t.transExpr(scope, cast.operand, .used);
             const int_from_bool = try ZigTag.int_from_bool.create(t.arena, sub_expr_node);
+            if (t.isBf16(dest_qt)) break :bool_to_float try t.createHelperCallNode(.floatToBf16, &.{int_from_bool});
             break :bool_to_float try ZigTag.float_from_int.create(t.arena, int_from_bool);
         },
         .bool_to_pointer => bool_to_pointer: {
@@ -2527,6 +3663,13 @@ fn transCastExpr(
         },
         .float_cast => float_cast: {
             const sub_expr_node = try t.transExpr(scope, cast.operand, .used);
+            if (t.isBf16(dest_qt)) {
+                break :float_cast try t.createHelperCallNode(.floatToBf16, &.{sub_expr_node});
+            }
+            if (t.isBf16(cast.operand.qt(t.tree))) {
+                const dest_type = try t.transType(scope, dest_qt, cast.l_paren);
+                break :float_cast try t.createHelperCallNode(.bf16ToFloat, &.{ dest_type, sub_expr_node });
+            }
             break :float_cast try ZigTag.float_cast.create(t.arena, sub_expr_node);
         },
         .int_to_float => int_to_float: {
@@ -2535,10 +3678,14 @@ fn transCastExpr(
                 try ZigTag.int_from_bool.create(t.arena, sub_expr_node)
             else
                 sub_expr_node;
+            if (t.isBf16(dest_qt)) break :int_to_float try t.createHelperCallNode(.floatToBf16, &.{int_node});
             break :int_to_float try ZigTag.float_from_int.create(t.arena, int_node);
         },
         .float_to_int => float_to_int: {
-            const sub_expr_node = try t.transExpr(scope, cast.operand, .used);
+            var sub_expr_node = try t.transExpr(scope, cast.operand, .used);
+            if (t.isBf16(cast.operand.qt(t.tree))) {
+                sub_expr_node = try t.bf16ToF32(sub_expr_node);
+            }
             break :float_to_int try ZigTag.int_from_float.create(t.arena, sub_expr_node);
         },
         .pointer_to_int => pointer_to_int: {
@@ -2589,7 +3736,15 @@ fn transCastExpr(
                 .inits = field_init[0..1],
             });
         },
-        else => return t.fail(error.UnsupportedTranslation, cast.l_paren, "TODO translate {s} cast", .{@tagName(cast.kind)}),
+        else => if (dest_qt.get(t.comp, .vector)) |vector_ty| vector_splat: {
+            // Scalar operands of vector expressions are converted to the
+            // element type and then broadcast to every element.
+            const src_qt = cast.operand.qt(t.tree);
+            if (src_qt.is(t.comp, .vector)) {
+                return t.fail(error.UnsupportedTranslation, cast.l_paren, "TODO translate {s} cast", .{@tagName(cast.kind)});
+            }
+            break :vector_splat try ZigTag.vector_zero_init.create(t.arena, try t.transVectorSplatElem(scope, cast.operand, vector_ty.elem));
+        } else return t.fail(error.UnsupportedTranslation, cast.l_paren, "TODO translate {s} cast", .{@tagName(cast.kind)}),
     };
     if (suppress_as == .no_as) return t.maybeSuppressResult(used, operand);
     if (used == .unused) return t.maybeSuppressResult(used, operand);
@@ -2600,8 +3755,65 @@ fn transCastExpr(
     return as;
 }
 
+/// Translate the scalar operand of a vector splat, converted to the element type of the vector.
+fn transVectorSplatElem(t: *Translator, scope: *Scope, operand: Node.Index, elem_qt: QualType) TransError!ZigNode {
+    // Constants coerce to the element type through the result type of @splat.
+    if (t.tree.value_map.get(operand) != null) {
+        return t.transExprCoercing(scope, operand, .used);
+    }
+
+    const src_qt = operand.qt(t.tree);
+    const sub_expr_node = try t.transExpr(scope, operand, .used);
+    const src_sk = src_qt.scalarKind(t.comp);
+    const dest_sk = elem_qt.scalarKind(t.comp);
+
+    if (src_sk == .float and dest_sk == .float) {
+        return ZigTag.float_cast.create(t.arena, sub_expr_node);
+    } else if (src_sk == .float) {
+        return ZigTag.int_from_float.create(t.arena, sub_expr_node);
+    }
+
+    const int_node = if (src_sk == .bool or sub_expr_node.isBoolRes())
+        try ZigTag.int_from_bool.create(t.arena, sub_expr_node)
+    else
+        sub_expr_node;
+    if (dest_sk == .float) {
+        return ZigTag.float_from_int.create(t.arena, int_node);
+    }
+    if (src_sk == .bool or sub_expr_node.isBoolRes()) return int_node;
+    return t.transIntCast(int_node, src_qt, elem_qt);
+}
+
+/// __helpers.bf16ToFloat(f32, node)
+fn bf16ToF32(t: *Translator, node: ZigNode) !ZigNode {
+    return t.createHelperCallNode(.bf16ToFloat, &.{ try ZigTag.type.create(t.arena, "f32"), node });
+}
+
+/// Whether `__bf16` is the return type or the type of a parameter of `func_ty`.
+fn hasBf16InSignature(t: *Translator, func_ty: aro.Type.Func) bool {
+    if (t.isBf16(func_ty.return_type)) return true;
+    for (func_ty.params) |param| {
+        if (t.isBf16(param.qt)) return true;
+    }
+    return false;
+}
+
+/// Returns true if `qt` is `__bf16`, which is translated as `__helpers.BFloat16` and
+/// needs explicit conversions to and from other arithmetic types.
+fn isBf16(t: *Translator, qt: QualType) bool {
+    return switch (qt.base(t.comp).type) {
+        .float => |float_ty| float_ty == .bf16,
+        else => false,
+    };
+}
+
 fn transIntCast(t: *Translator, operand: ZigNode, src_qt: QualType, dest_qt: QualType) !ZigNode {
-    const src_dest_order = src_qt.intRankOrder(dest_qt, t.comp);
+    // Bit-precise integers rank below standard integers of the same width, so
+    // the width has to be compared to know if the value fits.
+    const src_dest_order = if (src_qt.is(t.comp, .bit_int) or dest_qt.is(t.comp, .bit_int))
+        std.math.order(src_qt.bitSizeof(t.comp), dest_qt.bitSizeof(t.comp))
+    else
+        src_qt.intRankOrder(dest_qt, t.comp);
     const different_sign = t.signedness(src_qt) != t.signedness(dest_qt);
     const needs_bitcast = different_sign and !(t.signedness(src_qt) == .unsigned and src_dest_order == .lt);
 
@@ -2660,7 +3872,7 @@ fn transDeclRefExpr(t: *Translator, scope: *Scope, decl_ref: Node.DeclRef) Trans
                 .field_name = name,
             });
         }
-        if (decl == .variable and maybe_alias != null) {
+        if (decl == .variable and maybe_alias != null and !t.hoisted_static_locals.contains(mangled_name)) {
             switch (decl.variable.storage_class) {
                 .@"extern", .static => {
                     break :blk try ZigTag.field_access.create(t.arena, .{
@@ -2684,15 +3896,32 @@ fn transBinExpr(t: *Translator, scope: *Scope, bin: Node.Binary, op_id: ZigTag)
 
     const lhs = if (lhs_uncasted.isBoolRes())
         try ZigTag.int_from_bool.create(t.arena, lhs_uncasted)
+    else if (t.isBf16(bin.lhs.qt(t.tree)))
+        try t.bf16ToF32(lhs_uncasted)
     else
         lhs_uncasted;
 
     const rhs = if (rhs_uncasted.isBoolRes())
         try ZigTag.int_from_bool.create(t.arena, rhs_uncasted)
+    else if (t.isBf16(bin.rhs.qt(t.tree)))
+        try t.bf16ToF32(rhs_uncasted)
     else
         rhs_uncasted;
 
-    return t.createBinOpNode(op_id, lhs, rhs);
+    // `__bf16` arithmetic is done in `f32` and rounded back once.
+    const res = try t.createBinOpNode(op_id, lhs, rhs);
+    if (t.isBf16(bin.qt)) return t.createHelperCallNode(.floatToBf16, &.{res});
+    return res;
+}
+
+/// Vector comparisons produce a vector of booleans in Zig but a vector
+/// of 0/-1 integers in C.
+fn transCmpExpr(t: *Translator, scope: *Scope, bin: Node.Binary, op_id: ZigTag) TransError!ZigNode {
+    const cmp_node = try t.transBinExpr(scope, bin, op_id);
+    if (!bin.qt.is(t.comp, .vector)) return cmp_node;
+
+    const vector_type = try t.transType(scope, bin.qt, bin.op_tok);
+    return t.createHelperCallNode(.vectorMask, &.{ vector_type, cmp_node });
 }
 
 fn transBoolBinExpr(t: *Translator, scope: *Scope, bin: Node.Binary, op: ZigTag) !ZigNode {
@@ -2731,12 +3960,30 @@ fn transCondExpr(
     defer cond_scope.deinit();
 
     const res_is_bool = conditional.qt.is(t.comp, .bool);
-    const cond = try t.transBoolExpr(&cond_scope.base, conditional.cond);
+    const expected = t.expectedCond(conditional.cond);
+    const cond = try t.transBoolExpr(&cond_scope.base, if (expected) |some| some.cond else conditional.cond);
 
     var then_body = try t.transExpr(scope, conditional.then_expr, used);
     if (!res_is_bool and then_body.isBoolRes()) {
         then_body = try ZigTag.int_from_bool.create(t.arena, then_body);
     }
+    if (expected) |some| {
+        if (used == .used) {
+            // blk: { @branchHint(hint); break :blk then_body; }
+            var block_scope = try Scope.Block.init(t, scope, true);
+            defer block_scope.deinit();
+
+            try block_scope.statements.append(t.gpa, try t.createBranchHintNode(some.hint));
+            const break_node = try ZigTag.break_val.create(t.arena, .{
+                .label = block_scope.label,
+                .val = then_body,
+            });
+            try block_scope.statements.append(t.gpa, break_node);
+            then_body = try block_scope.complete();
+        } else {
+            then_body = try t.addBranchHint(then_body, some.hint);
+        }
+    }
 
     var else_body = try t.transExpr(scope, conditional.else_expr, used);
     if (!res_is_bool and else_body.isBoolRes()) {
@@ -2941,6 +4188,8 @@ fn transCompoundAssign(
 fn transCompoundAssignSimple(t: *Translator, scope: *Scope, lhs_dummy_opt: ?ZigNode, assign: Node.Binary) TransError!?ZigNode {
     const assign_rhs = assign.rhs.get(t.tree);
     if (assign_rhs == .cast) return null;
+    // `__bf16` arithmetic goes through `transBinExpr`, which converts to and from `f32`.
+    if (t.isBf16(assign.qt)) return null;
 
     const is_signed = t.signedness(assign.qt) == .signed;
     switch (assign_rhs) {
@@ -2987,7 +4236,7 @@ fn transCompoundAssignSimple(t: *Translator, scope: *Scope, lhs_dummy_opt: ?ZigN
     const casted_rhs = switch (cast) {
         .none => rhs_node,
         .shift => try ZigTag.int_cast.create(t.arena, rhs_node),
-        .usize => try t.usizeCastForWrappingPtrArithmetic(rhs_node),
+        .usize => try t.usizeCastForWrappingPtrArithmetic(rhs_node, bin.rhs),
     };
     return try t.createBinOpNode(op, lhs_node, casted_rhs);
 }
@@ -3005,14 +4254,15 @@ fn transIncDecExpr(
         .inc => if (is_wrapping) .add_wrap_assign else .add_assign,
         .dec => if (is_wrapping) .sub_wrap_assign else .sub_assign,
     };
+    const is_bf16 = t.isBf16(un.qt);
 
     const one_literal = ZigTag.one_literal.init();
-    if (used == .unused) {
+    if (used == .unused and !is_bf16) {
         const operand = try t.transExpr(scope, un.operand, .used);
         return try t.createBinOpNode(op, operand, one_literal);
     }
 
-    var block_scope = try Scope.Block.init(t, scope, true);
+    var block_scope = try Scope.Block.init(t, scope, used == .used);
     defer block_scope.deinit();
 
     const ref = try block_scope.reserveMangledName("ref");
@@ -3023,7 +4273,17 @@ fn transIncDecExpr(
 
     const ref_ident = try ZigTag.identifier.create(t.arena, ref);
     const ref_deref = try ZigTag.deref.create(t.arena, ref_ident);
-    const effect = try t.createBinOpNode(op, ref_deref, one_literal);
+    // ref.* = __helpers.floatToBf16(__helpers.bf16ToFloat(f32, ref.*) + 1)
+    const effect = if (is_bf16) effect: {
+        const float_op: ZigTag = if (kind == .inc) .add else .sub;
+        const sum = try t.createBinOpNode(float_op, try t.bf16ToF32(ref_deref), one_literal);
+        break :effect try t.createBinOpNode(.assign, ref_deref, try t.createHelperCallNode(.floatToBf16, &.{sum}));
+    } else try t.createBinOpNode(op, ref_deref, one_literal);
+
+    if (used == .unused) {
+        try block_scope.statements.append(t.gpa, effect);
+        return try block_scope.complete();
+    }
 
     switch (position) {
         .pre => {
@@ -3092,7 +4352,7 @@ fn transPtrDiffExpr(t: *Translator, scope: *Scope, bin: Node.Binary) TransError!
 }
 
 /// Translate an arithmetic expression with a pointer operand and a signed-integer operand.
-/// Zig requires a usize argument for pointer arithmetic, so we intCast to isize and then
+/// Zig requires a usize argument for pointer arithmetic, so we sign extend to isize and then
 /// bitcast to usize; pointer wraparound makes the math work.
 /// Zig pointer addition is not commutative (unlike C); the pointer operand needs to be on the left.
 /// The + operator in C is not a sequence point so it should be safe to switch the order if necessary.
@@ -3108,9 +4368,9 @@ fn transPointerArithmeticSignedOp(t: *Translator, scope: *Scope, bin: Node.Binar
     const lhs_node = try t.transExpr(scope, swizzled_lhs, .used);
     const rhs_node = try t.transExpr(scope, swizzled_rhs, .used);
 
-    const bitcast_node = try t.usizeCastForWrappingPtrArithmetic(rhs_node);
+    const offset_node = try t.usizeCastForWrappingPtrArithmetic(rhs_node, swizzled_rhs);
 
-    return t.createBinOpNode(op_id, lhs_node, bitcast_node);
+    return t.createBinOpNode(op_id, lhs_node, offset_node);
 }
 
 fn transMemberAccess(
@@ -3166,7 +4426,29 @@ fn transArrayAccess(t: *Translator, scope: *Scope, array_access: Node.ArrayAcces
         break :base base.cast.operand;
     };
 
-    const base_node = opt_base orelse try t.transExpr(scope, base, .used);
+    var base_node = opt_base orelse try t.transExpr(scope, base, .used);
+    const base_qt = base.qt(t.tree);
+    if (base_qt.get(t.comp, .vector)) |vector_ty| {
+        if (!vector_ty.elem.is(t.comp, .bool) and t.isAddressable(base)) {
+            // Index vectors through a pointer to an array with the same layout
+            // so that runtime indexes work both as lvalues and rvalues.
+            const array_type = try ZigTag.array_type.create(t.arena, .{
+                .len = vector_ty.len,
+                .elem_type = try t.transType(scope, vector_ty.elem, base.tok(t.tree)),
+            });
+            const ptr_type = try ZigTag.single_pointer.create(t.arena, .{
+                .elem_type = array_type,
+                .is_allowzero = false,
+                .is_const = base_qt.@"const",
+                .is_volatile = base_qt.@"volatile",
+            });
+            const ref = try ZigTag.address_of.create(t.arena, base_node);
+            base_node = try ZigTag.as.create(t.arena, .{
+                .lhs = ptr_type,
+                .rhs = try ZigTag.ptr_cast.create(t.arena, ref),
+            });
+        }
+    }
     const index = index: {
         const index = try t.transExpr(scope, array_access.index, .used);
         const index_qt = array_access.index.qt(t.tree);
@@ -3190,13 +4472,11 @@ fn transArrayAccess(t: *Translator, scope: *Scope, array_access: Node.ArrayAcces
         const is_signed = t.signedness(index_qt) == .signed;
 
         if (is_signed and !is_nonnegative_int_literal) {
-            // First cast to `isize` to get proper sign extension and
-            // then @bitCast to `usize` to satisfy the compiler.
-            const index_isize = try ZigTag.as.create(t.arena, .{
-                .lhs = try ZigTag.type.create(t.arena, "isize"),
-                .rhs = try ZigTag.int_cast.create(t.arena, index),
-            });
-            break :index try ZigTag.bit_cast.create(t.arena, index_isize);
+            // Induction variables that are never negative need no sign extension.
+            if (t.isNonNegative(array_access.index)) {
+                break :index try ZigTag.int_cast.create(t.arena, index);
+            }
+            break :index try t.createHelperCallNode(.signedOffset, &.{index});
         }
 
         if (maybe_bigger_than_usize) {
@@ -3211,6 +4491,24 @@ fn transArrayAccess(t: *Translator, scope: *Scope, array_access: Node.ArrayAcces
     });
 }
 
+/// Returns true if `&expr` is valid for the translation of `expr`.
+fn isAddressable(t: *Translator, expr: Node.Index) bool {
+    return loop: switch (expr.get(t.tree)) {
+        .decl_ref_expr,
+        .member_access_expr,
+        .member_access_ptr_expr,
+        .deref_expr,
+        .array_access_expr,
+        => true,
+        .paren_expr => |paren_expr| continue :loop paren_expr.operand.get(t.tree),
+        .cast => |cast| switch (cast.kind) {
+            .lval_to_rval, .no_op => continue :loop cast.operand.get(t.tree),
+            else => false,
+        },
+        else => false,
+    };
+}
+
 fn transOffsetof(t: *Translator, scope: *Scope, arg: Node.Index) TransError!ZigNode {
     // Translate __builtin_offsetof(T, designator) as
     // @intFromPtr(&(@as(*allowzero T, @ptrFromInt(0)).designator))
@@ -3248,6 +4546,107 @@ fn transMemberDesignator(t: *Translator, scope: *Scope, arg: Node.Index) TransEr
     }
 }
 
+/// Returns the result of `__builtin_object_size(ptr, kind)` if `kind` is constant.
+/// The size is computed from the type of the object `ptr` points to if it is the start
+/// of a variable, a member of one or a string literal, other pointers may point into
+/// a larger object.
+fn knownObjectSize(t: *Translator, ptr: Node.Index, kind_node: Node.Index) ?u64 {
+    const kind_val = t.tree.value_map.get(kind_node) orelse return null;
+    const kind = kind_val.toInt(u2, t.comp) orelse return null;
+    const is_maximum = kind & 2 == 0;
+    const is_subobject = kind & 1 != 0;
+
+    const object: ?Node.Index = loop: switch (ptr.get(t.tree)) {
+        .paren_expr => |paren_expr| continue :loop paren_expr.operand.get(t.tree),
+        .cast => |cast| switch (cast.kind) {
+            .no_op, .bitcast => continue :loop cast.operand.get(t.tree),
+            .array_to_pointer => break :loop cast.operand,
+            else => break :loop null,
+        },
+        .addr_of_expr => |addr_of| break :loop addr_of.operand,
+        else => break :loop null,
+    };
+    const object_qt: ?QualType = if (object) |node| switch (node.get(t.tree)) {
+        .decl_ref_expr => |decl_ref| if (decl_ref.decl.get(t.tree) == .variable) decl_ref.qt else null,
+        .string_literal_expr, .compound_literal_expr => node.qt(t.tree),
+        // The bytes after the member are not known without its offset.
+        .member_access_expr => |member_access| if (is_subobject and t.isVariableMember(member_access.base))
+            node.qt(t.tree)
+        else
+            null,
+        else => null,
+    } else null;
+    if (object_qt) |qt| {
+        if (!qt.hasIncompleteSize(t.comp)) return qt.sizeof(t.comp);
+    }
+    // The object is unknown.
+    if (!is_maximum) return 0;
+    return t.maxUsize();
+}
+
+/// The value of `SIZE_MAX` on the target.
+fn maxUsize(t: *Translator) u64 {
+    return std.math.maxInt(u64) >> @intCast(64 - t.comp.target.ptrBitWidth());
+}
+
+/// Returns true if `expr` names a variable or a member of one.
+fn isVariableMember(t: *Translator, expr: Node.Index) bool {
+    return loop: switch (expr.get(t.tree)) {
+        .paren_expr => |paren_expr| continue :loop paren_expr.operand.get(t.tree),
+        .member_access_expr => |member_access| continue :loop member_access.base.get(t.tree),
+        .decl_ref_expr => |decl_ref| decl_ref.decl.get(t.tree) == .variable,
+        else => false,
+    };
+}
+
+/// Translates `__builtin___memcpy_chk(dst, src, len, remaining)` and similar as the
+/// unchecked builtin if `remaining` is known to be large enough for `len`. Returns
+/// null if nothing is known about `remaining`.
+fn transCheckedMemBuiltin(t: *Translator, scope: *Scope, call: Node.BuiltinCall, name: []const u8) TransError!?ZigNode {
+    assert(call.args.len == 4);
+    const remaining = t.constantSize(call.args[3]) orelse return null;
+    const is_unchecked = remaining == t.maxUsize() or
+        if (t.constantSize(call.args[2])) |len| len <= remaining else false;
+
+    const arg_nodes = try t.arena.alloc(ZigNode, if (is_unchecked) 3 else 4);
+    for (call.args[0..3], arg_nodes[0..3]) |c_arg, *zig_arg| {
+        zig_arg.* = try t.transExprCoercing(scope, c_arg, .used);
+    }
+    if (!is_unchecked) arg_nodes[3] = try t.createUsizeNode(remaining);
+
+    const builtin_identifier = try ZigTag.identifier.create(t.arena, "__builtin");
+    const field_access = try ZigTag.field_access.create(t.arena, .{
+        .lhs = builtin_identifier,
+        .field_name = if (is_unchecked) name[0 .. name.len - "_chk".len] else name,
+    });
+    return try ZigTag.call.create(t.arena, .{ .lhs = field_access, .args = arg_nodes });
+}
+
+/// Returns the value of `expr` if it is an integer constant or a foldable `__builtin_object_size` call.
+fn constantSize(t: *Translator, expr: Node.Index) ?u64 {
+    if (t.tree.value_map.get(expr)) |val| return val.toInt(u64, t.comp);
+    return loop: switch (expr.get(t.tree)) {
+        .paren_expr => |paren_expr| continue :loop paren_expr.operand.get(t.tree),
+        .cast => |cast| {
+            if (!cast.implicit or cast.kind != .int_cast) return null;
+            continue :loop cast.operand.get(t.tree);
+        },
+        .builtin_call_expr => |call| {
+            if (!mem.eql(u8, t.tree.tokSlice(call.builtin_tok), "__builtin_object_size")) return null;
+            return t.knownObjectSize(call.args[0], call.args[1]);
+        },
+        else => null,
+    };
+}
+
+/// @as(usize, size)
+fn createUsizeNode(t: *Translator, size: u64) !ZigNode {
+    return ZigTag.as.create(t.arena, .{
+        .lhs = try ZigTag.type.create(t.arena, "usize"),
+        .rhs = try t.createNumberNode(size, .int),
+    });
+}
+
 fn transBuiltinCall(
     t: *Translator,
     scope: *Scope,
@@ -3278,10 +4677,31 @@ fn transBuiltinCall(
         else => unreachable,
     };
 
-    const arg_nodes = try t.arena.alloc(ZigNode, call.args.len);
-    for (call.args, arg_nodes) |c_arg, *zig_arg| {
+    if (mem.eql(u8, builtin.name, "assume_aligned") and call.args.len == 3) {
+        return t.fail(error.UnsupportedTranslation, call.builtin_tok, "TODO __builtin_assume_aligned with an offset", .{});
+    }
+
+    if (mem.eql(u8, builtin.name, "object_size")) {
+        if (t.knownObjectSize(call.args[0], call.args[1])) |size| {
+            return t.maybeSuppressResult(used, try t.createUsizeNode(size));
+        }
+    } else if (mem.endsWith(u8, builtin.name, "_chk")) {
+        if (try t.transCheckedMemBuiltin(scope, call, builtin.name)) |res| {
+            return t.maybeSuppressResult(used, res);
+        }
+    }
+
+    // `__builtin_prefetch(addr, rw = 0, locality = 3)` has optional arguments
+    // which `c_builtins.prefetch` requires to be passed explicitly.
+    const is_prefetch = mem.eql(u8, builtin.name, "prefetch");
+    const arg_nodes = try t.arena.alloc(ZigNode, if (is_prefetch) 3 else call.args.len);
+    for (call.args, arg_nodes[0..call.args.len]) |c_arg, *zig_arg| {
         zig_arg.* = try t.transExprCoercing(scope, c_arg, .used);
     }
+    if (is_prefetch) {
+        if (call.args.len < 2) arg_nodes[1] = ZigTag.zero_literal.init();
+        if (call.args.len < 3) arg_nodes[2] = try t.createNumberNode(3, .int);
+    }
 
     const builtin_identifier = try ZigTag.identifier.create(t.arena, "__builtin");
     const field_access = try ZigTag.field_access.create(t.arena, .{
@@ -3304,13 +4724,17 @@ fn transCall(
     used: ResultUsed,
 ) TransError!ZigNode {
     const raw_fn_expr = try t.transExpr(scope, call.callee, .used);
+    var never_inline = false;
     const fn_expr = blk: {
         loop: switch (call.callee.get(t.tree)) {
             .paren_expr => |paren_expr| {
                 continue :loop paren_expr.operand.get(t.tree);
             },
             .decl_ref_expr => |decl_ref| {
-                if (decl_ref.qt.is(t.comp, .func)) break :blk raw_fn_expr;
+                if (decl_ref.qt.is(t.comp, .func)) {
+                    never_inline = decl_ref.qt.getAttribute(t.comp, .@"noinline") != null;
+                    break :blk raw_fn_expr;
+                }
             },
             .cast => |cast| {
                 if (cast.kind == .function_to_pointer) {
@@ -3362,10 +4786,10 @@ fn transCall(
         }
     }
 
-    const res = try ZigTag.call.create(t.arena, .{
-        .lhs = fn_expr,
-        .args = arg_nodes,
-    });
+    const res = if (never_inline)
+        try ZigTag.never_inline_call.create(t.arena, .{ .lhs = fn_expr, .args = arg_nodes })
+    else
+        try ZigTag.call.create(t.arena, .{ .lhs = fn_expr, .args = arg_nodes });
     if (call.qt.is(t.comp, .void)) return res;
     return t.maybeSuppressResult(used, res);
 }
@@ -3445,6 +4869,9 @@ fn transFloatLiteral(
     _ = val.print(float_literal.qt, t.comp, &allocating.writer) catch return error.OutOfMemory;
 
     const float_lit_node = try ZigTag.float_literal.create(t.arena, try t.arena.dupe(u8, allocating.written()));
+    if (t.isBf16(float_literal.qt)) {
+        return t.maybeSuppressResult(used, try t.createHelperCallNode(.floatToBf16, &.{float_lit_node}));
+    }
     if (suppress_as == .no_as) {
         return t.maybeSuppressResult(used, float_lit_node);
     }
@@ -3929,7 +5356,7 @@ fn createZeroValueNode(
 ) !ZigNode {
     switch (qt.base(t.comp).type) {
         .bool => return ZigTag.false_literal.init(),
-        .int, .bit_int, .float => {
+        .int, .bit_int, .float => if (!t.isBf16(qt)) {
             const zero_literal = ZigTag.zero_literal.init();
             return switch (suppress_as) {
                 .with_as => try t.createBinOpNode(.as, type_node, zero_literal),
@@ -4009,20 +5436,16 @@ pub fn createHelperCallNode(t: *Translator, name: std.meta.DeclEnum(@import("hel
     }
 }
 
-/// Cast a signed integer node to a usize, for use in pointer arithmetic. Negative numbers
-/// will become very large positive numbers but that is ok since we only use this in
-/// pointer arithmetic expressions, where wraparound will ensure we get the correct value.
-/// node -> @as(usize, @bitCast(@as(isize, @intCast(node))))
-fn usizeCastForWrappingPtrArithmetic(t: *Translator, node: ZigNode) TransError!ZigNode {
-    const intcast_node = try ZigTag.as.create(t.arena, .{
-        .lhs = try ZigTag.type.create(t.arena, "isize"),
-        .rhs = try ZigTag.int_cast.create(t.arena, node),
-    });
-
-    return ZigTag.as.create(t.arena, .{
-        .lhs = try ZigTag.type.create(t.arena, "usize"),
-        .rhs = try ZigTag.bit_cast.create(t.arena, intcast_node),
-    });
+/// Converts the translation `node` of the signed integer `expr` to `usize`.
+/// Negative values wrap around which gives the same result as in C for pointer arithmetic.
+fn usizeCastForWrappingPtrArithmetic(t: *Translator, node: ZigNode, expr: Node.Index) TransError!ZigNode {
+    if (t.isNonNegative(expr)) {
+        return ZigTag.as.create(t.arena, .{
+            .lhs = try ZigTag.type.create(t.arena, "usize"),
+            .rhs = try ZigTag.int_cast.create(t.arena, node),
+        });
+    }
+    return t.createHelperCallNode(.signedOffset, &.{node});
 }
 
 /// @typeInfo(@TypeOf(vec_node)).vector.<field>
@@ -4101,61 +5524,75 @@ fn transMacros(t: *Translator) !void {
         if (t.global_scope.containsNow(name)) {
             continue;
         }
+        if (try t.isNameInBase(name, macro.loc.id)) continue;
+        try t.enterFile(macro.loc.id);
 
-        tok_list.items.len = 0;
-        try tok_list.ensureUnusedCapacity(t.gpa, macro.tokens.len);
-        for (macro.tokens) |tok| {
-            switch (tok.id) {
-                .invalid => continue,
-                .whitespace => continue,
-                .comment => continue,
-                .macro_ws => continue,
-                else => {},
-            }
-            tok_list.appendAssumeCapacity(tok);
-        }
-
-        if (macro.is_func) {
-            const ms: PatternList.MacroSlicer = .{
-                .tokens = tok_list.items,
-                .source = t.comp.getSource(macro.loc.id).buf,
-                .params = @intCast(macro.params.len),
-            };
-            if (try pattern_list.match(ms)) |impl| {
-                const decl = try ZigTag.pub_var_simple.create(t.arena, .{
-                    .name = name,
-                    .init = try t.createHelperCallNode(impl, null),
-                });
-                try t.addTopLevelDecl(name, decl);
-                continue;
-            }
-        }
+        const start = if (t.profiler) |profiler| profiler.now() else 0;
+        try t.transMacro(name, macro, &tok_list, &pattern_list);
+        if (t.profiler) |profiler| try profiler.addItem(.macro, name, macro.loc, start);
+    }
+}
 
-        if (t.checkTranslatableMacro(tok_list.items, macro.params)) |err| {
-            switch (err) {
-                .undefined_identifier => |ident| try t.failDeclExtra(&t.global_scope.base, macro.loc, name, "unable to translate macro: undefined identifier `{s}`", .{ident}),
-                .invalid_arg_usage => |ident| try t.failDeclExtra(&t.global_scope.base, macro.loc, name, "unable to translate macro: untranslatable usage of arg `{s}`", .{ident}),
-            }
-            continue;
+fn transMacro(
+    t: *Translator,
+    name: []const u8,
+    macro: aro.Preprocessor.Macro,
+    tok_list: *std.ArrayList(CToken),
+    pattern_list: *PatternList,
+) !void {
+    tok_list.items.len = 0;
+    try tok_list.ensureUnusedCapacity(t.gpa, macro.tokens.len);
+    for (macro.tokens) |tok| {
+        switch (tok.id) {
+            .invalid => continue,
+            .whitespace => continue,
+            .comment => continue,
+            .macro_ws => continue,
+            else => {},
         }
+        tok_list.appendAssumeCapacity(tok);
+    }
 
-        var macro_translator: MacroTranslator = .{
-            .t = t,
+    if (macro.is_func) {
+        const ms: PatternList.MacroSlicer = .{
             .tokens = tok_list.items,
             .source = t.comp.getSource(macro.loc.id).buf,
-            .name = name,
-            .macro = macro,
+            .params = @intCast(macro.params.len),
         };
+        if (try pattern_list.match(ms)) |impl| {
+            const decl = try ZigTag.pub_var_simple.create(t.arena, .{
+                .name = name,
+                .init = try t.createHelperCallNode(impl, null),
+            });
+            try t.addTopLevelDecl(name, decl);
+            return;
+        }
+    }
 
-        const res = if (macro.is_func)
-            macro_translator.transFnMacro()
-        else
-            macro_translator.transMacro();
-        res catch |err| switch (err) {
-            error.ParseError => continue,
-            error.OutOfMemory => |e| return e,
-        };
+    if (t.checkTranslatableMacro(tok_list.items, macro.params)) |err| {
+        switch (err) {
+            .undefined_identifier => |ident| try t.failMacro(macro.loc, name, "unable to translate macro: undefined identifier `{s}`", .{ident}),
+            .invalid_arg_usage => |ident| try t.failMacro(macro.loc, name, "unable to translate macro: untranslatable usage of arg `{s}`", .{ident}),
+        }
+        return;
     }
+
+    var macro_translator: MacroTranslator = .{
+        .t = t,
+        .tokens = tok_list.items,
+        .source = t.comp.getSource(macro.loc.id).buf,
+        .name = name,
+        .macro = macro,
+    };
+
+    const res = if (macro.is_func)
+        macro_translator.transFnMacro()
+    else
+        macro_translator.transMacro();
+    res catch |err| switch (err) {
+        error.ParseError => return,
+        error.OutOfMemory => |e| return e,
+    };
 }
 
 const MacroTranslateError = union(enum) {
@@ -4205,6 +5642,7 @@ fn getContainer(t: *Translator, node: ZigNode) ?ZigNode {
         .array_type,
         .c_pointer,
         .single_pointer,
+        .many_pointer,
         => return node,
 
         .identifier => {
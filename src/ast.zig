@@ -48,6 +48,8 @@ pub const Node = extern union {
         /// items => body,
         switch_prong,
         break_val,
+        /// continue :label val
+        continue_val,
         @"return",
         field_access,
         array_access,
@@ -120,6 +122,8 @@ pub const Node = extern union {
         volatile_cast,
         /// @divTrunc(lhs, rhs)
         div_trunc,
+        /// @rem(lhs, rhs)
+        rem,
         /// @intFromBool(operand)
         int_from_bool,
         /// @as(lhs, rhs)
@@ -152,6 +156,10 @@ pub const Node = extern union {
         shuffle,
         /// @extern(ty, .{ .name = n })
         builtin_extern,
+        /// @branchHint(operand)
+        branch_hint,
+        /// @call(.never_inline, lhs, .{args})
+        never_inline_call,
 
         /// @byteSwap(operand)
         byte_swap,
@@ -214,6 +222,8 @@ pub const Node = extern union {
         optional_type,
         c_pointer,
         single_pointer,
+        /// [*]elem_type
+        many_pointer,
         array_type,
         null_sentinel_array_type,
 
@@ -309,6 +319,7 @@ pub const Node = extern union {
                 .const_cast,
                 .volatile_cast,
                 .vector_zero_init,
+                .branch_hint,
                 .byte_swap,
                 .ceil,
                 .cos,
@@ -361,6 +372,7 @@ pub const Node = extern union {
                 .bit_xor,
                 .bit_xor_assign,
                 .div_trunc,
+                .rem,
                 .as,
                 .array_cat,
                 .ellipsis3,
@@ -386,8 +398,8 @@ pub const Node = extern union {
                 .@"if" => Payload.If,
                 .@"while" => Payload.While,
                 .@"switch", .array_init, .switch_prong => Payload.Switch,
-                .break_val => Payload.BreakVal,
-                .call => Payload.Call,
+                .break_val, .continue_val => Payload.BreakVal,
+                .call, .never_inline_call => Payload.Call,
                 .var_decl => Payload.VarDecl,
                 .func => Payload.Func,
                 .@"struct", .@"union", .@"opaque" => Payload.Container,
@@ -395,7 +407,7 @@ pub const Node = extern union {
                 .container_init => Payload.ContainerInit,
                 .container_init_dot => Payload.ContainerInitDot,
                 .block => Payload.Block,
-                .c_pointer, .single_pointer => Payload.Pointer,
+                .c_pointer, .single_pointer, .many_pointer => Payload.Pointer,
                 .array_type, .null_sentinel_array_type => Payload.Array,
                 .arg_redecl, .alias => Payload.ArgRedecl,
                 .fail_decl => Payload.FailDecl,
@@ -481,7 +493,7 @@ pub const Node = extern union {
             },
             .@"return", .return_void => true,
             .@"break" => true,
-            .@"continue" => true,
+            .@"continue", .continue_val => true,
             .@"unreachable" => true,
             else => false,
         };
@@ -556,6 +568,8 @@ pub const Payload = struct {
     pub const Switch = struct {
         base: Payload,
         data: struct {
+            /// Only used by `switch`, targeted by `continue_val`.
+            label: ?[]const u8 = null,
             cond: Node,
             cases: []Node,
         },
@@ -1094,6 +1108,21 @@ fn renderNode(c: *Context, node: Node) Allocator.Error!NodeIndex {
                 } },
             });
         },
+        .continue_val => {
+            const payload = node.castTag(.continue_val).?.data;
+            const tok = try c.addToken(.keyword_continue, "continue");
+            const continue_label = if (payload.label) |some| blk: {
+                _ = try c.addToken(.colon, ":");
+                break :blk try c.addIdentifier(some);
+            } else 0;
+            return c.addNode(.{
+                .tag = .@"continue",
+                .main_token = tok,
+                .data = .{ .opt_token_and_opt_node = .{
+                    .fromToken(continue_label), (try renderNode(c, payload.val)).toOptional(),
+                } },
+            });
+        },
         .@"return" => {
             const payload = node.castTag(.@"return").?.data;
             return c.addNode(.{
@@ -1404,6 +1433,10 @@ fn renderNode(c: *Context, node: Node) Allocator.Error!NodeIndex {
             const payload = node.castTag(.div_trunc).?.data;
             return renderBuiltinCall(c, "@divTrunc", &.{ payload.lhs, payload.rhs });
         },
+        .rem => {
+            const payload = node.castTag(.rem).?.data;
+            return renderBuiltinCall(c, "@rem", &.{ payload.lhs, payload.rhs });
+        },
         .int_from_bool => {
             const payload = node.castTag(.int_from_bool).?.data;
             return renderBuiltinCall(c, "@intFromBool", &.{payload});
@@ -1485,6 +1518,28 @@ fn renderNode(c: *Context, node: Node) Allocator.Error!NodeIndex {
                 .{ .ptr_otherwise = &info_payload.base },
             });
         },
+        .branch_hint => {
+            const payload = node.castTag(.branch_hint).?.data;
+            return renderBuiltinCall(c, "@branchHint", &.{payload});
+        },
+        .never_inline_call => {
+            const payload = node.castTag(.never_inline_call).?.data;
+
+            var modifier_payload: Payload.Value = .{
+                .base = .{ .tag = .enum_literal },
+                .data = "never_inline",
+            };
+            var args_payload: Payload.TupleInit = .{
+                .base = .{ .tag = .tuple },
+                .data = payload.args,
+            };
+
+            return renderBuiltinCall(c, "@call", &.{
+                .{ .ptr_otherwise = &modifier_payload.base },
+                payload.lhs,
+                .{ .ptr_otherwise = &args_payload.base },
+            });
+        },
         .helper_call => {
             const payload = node.castTag(.helper_call).?.data;
             const helpers_tok = try c.addNode(.{
@@ -1619,7 +1674,7 @@ fn renderNode(c: *Context, node: Node) Allocator.Error!NodeIndex {
                 } },
             });
         },
-        .c_pointer, .single_pointer => {
+        .c_pointer, .single_pointer, .many_pointer => {
             const payload = @as(*Payload.Pointer, @alignCast(@fieldParentPtr("base", node.ptr_otherwise))).data;
 
             const main_token = if (node.tag() == .single_pointer)
@@ -1627,7 +1682,7 @@ fn renderNode(c: *Context, node: Node) Allocator.Error!NodeIndex {
             else blk: {
                 const res = try c.addToken(.l_bracket, "[");
                 _ = try c.addToken(.asterisk, "*");
-                _ = try c.addIdentifier("c");
+                if (node.tag() == .c_pointer) _ = try c.addIdentifier("c");
                 _ = try c.addToken(.r_bracket, "]");
                 break :blk res;
             };
@@ -1865,6 +1920,10 @@ fn renderNode(c: *Context, node: Node) Allocator.Error!NodeIndex {
         },
         .@"switch" => {
             const payload = node.castTag(.@"switch").?.data;
+            if (payload.label) |some| {
+                _ = try c.addIdentifier(some);
+                _ = try c.addToken(.colon, ":");
+            }
             const switch_tok = try c.addToken(.keyword_switch, "switch");
             _ = try c.addToken(.l_paren, "(");
             const cond = try renderNode(c, payload.cond);
@@ -2464,6 +2523,7 @@ fn renderNodeGrouped(c: *Context, node: Node) !NodeIndex {
         .noreturn_type,
         .@"anytype",
         .div_trunc,
+        .rem,
         .int_cast,
         .const_cast,
         .volatile_cast,
@@ -2497,6 +2557,7 @@ fn renderNodeGrouped(c: *Context, node: Node) !NodeIndex {
         .optional_type,
         .c_pointer,
         .single_pointer,
+        .many_pointer,
         .unwrap,
         .deref,
         .not,
@@ -2512,6 +2573,8 @@ fn renderNodeGrouped(c: *Context, node: Node) !NodeIndex {
         .offset_of,
         .shuffle,
         .builtin_extern,
+        .branch_hint,
+        .never_inline_call,
         .wrapped_local,
         .mut_str,
         .helper_call,
@@ -2597,6 +2660,7 @@ fn renderNodeGrouped(c: *Context, node: Node) !NodeIndex {
         .@"switch",
         .@"break",
         .break_val,
+        .continue_val,
         .pub_inline_fn,
         .discard,
         .@"continue",
@@ -2750,6 +2814,13 @@ fn renderBuiltinCall(c: *Context, builtin: []const u8, args: []const Node) !Node
             _ = try c.addToken(.comma, ",");
             arg_2 = try renderNode(c, args[1]);
         },
+        3 => {
+            arg_1 = try renderNode(c, args[0]);
+            _ = try c.addToken(.comma, ",");
+            arg_2 = try renderNode(c, args[1]);
+            _ = try c.addToken(.comma, ",");
+            arg_3 = try renderNode(c, args[2]);
+        },
         4 => {
             arg_1 = try renderNode(c, args[0]);
             _ = try c.addToken(.comma, ",");
@@ -2772,9 +2843,10 @@ fn renderBuiltinCall(c: *Context, builtin: []const u8, args: []const Node) !Node
             } },
         });
     } else {
-        std.debug.assert(args.len == 4);
-
-        const params = try c.listToSpan(&.{ arg_1.?, arg_2.?, arg_3.?, arg_4.? });
+        const params = if (args.len == 3)
+            try c.listToSpan(&.{ arg_1.?, arg_2.?, arg_3.? })
+        else
+            try c.listToSpan(&.{ arg_1.?, arg_2.?, arg_3.?, arg_4.? });
         return c.addNode(.{
             .tag = .builtin_call,
             .main_token = builtin_tok,
@@ -13,17 +13,28 @@ pub const Builtin = struct {
 
 pub const map = std.StaticStringMap(Builtin).initComptime([_]struct { []const u8, Builtin }{
     .{ "__builtin_abs", .{ .name = "abs" } },
+    .{ "__builtin_add_overflow", .{ .name = "add_overflow" } },
     .{ "__builtin_assume", .{ .name = "assume" } },
+    .{ "__builtin_assume_aligned", .{ .name = "assume_aligned" } },
     .{ "__builtin_bswap16", .{ .name = "bswap16", .tag = .byte_swap } },
     .{ "__builtin_bswap32", .{ .name = "bswap32", .tag = .byte_swap } },
     .{ "__builtin_bswap64", .{ .name = "bswap64", .tag = .byte_swap } },
     .{ "__builtin_ceilf", .{ .name = "ceilf", .tag = .ceil } },
     .{ "__builtin_ceil", .{ .name = "ceil", .tag = .ceil } },
     .{ "__builtin_clz", .{ .name = "clz" } },
+    .{ "__builtin_clzl", .{ .name = "clzl" } },
+    .{ "__builtin_clzll", .{ .name = "clzll" } },
     .{ "__builtin_constant_p", .{ .name = "constant_p" } },
     .{ "__builtin_cosf", .{ .name = "cosf", .tag = .cos } },
     .{ "__builtin_cos", .{ .name = "cos", .tag = .cos } },
     .{ "__builtin_ctz", .{ .name = "ctz" } },
+    .{ "__builtin_ctzl", .{ .name = "ctzl" } },
+    .{ "__builtin_ctzll", .{ .name = "ctzll" } },
+    .{ "__builtin_elementwise_abs", .{ .name = "elementwise_abs" } },
+    .{ "__builtin_elementwise_add_sat", .{ .name = "elementwise_add_sat" } },
+    .{ "__builtin_elementwise_max", .{ .name = "elementwise_max" } },
+    .{ "__builtin_elementwise_min", .{ .name = "elementwise_min" } },
+    .{ "__builtin_elementwise_sub_sat", .{ .name = "elementwise_sub_sat" } },
     .{ "__builtin_exp2f", .{ .name = "exp2f", .tag = .exp2 } },
     .{ "__builtin_exp2", .{ .name = "exp2", .tag = .exp2 } },
     .{ "__builtin_expf", .{ .name = "expf", .tag = .exp } },
@@ -34,6 +45,96 @@ pub const map = std.StaticStringMap(Builtin).initComptime([_]struct { []const u8
     .{ "__builtin_floorf", .{ .name = "floorf", .tag = .floor } },
     .{ "__builtin_floor", .{ .name = "floor", .tag = .floor } },
     .{ "__builtin_huge_valf", .{ .name = "huge_valf" } },
+    .{ "__builtin_ia32_cmpeqpd", .{ .name = "ia32_cmpeqpd" } },
+    .{ "__builtin_ia32_cmpeqps", .{ .name = "ia32_cmpeqps" } },
+    .{ "__builtin_ia32_cmplepd", .{ .name = "ia32_cmplepd" } },
+    .{ "__builtin_ia32_cmpleps", .{ .name = "ia32_cmpleps" } },
+    .{ "__builtin_ia32_cmpltpd", .{ .name = "ia32_cmpltpd" } },
+    .{ "__builtin_ia32_cmpltps", .{ .name = "ia32_cmpltps" } },
+    .{ "__builtin_ia32_cmpneqpd", .{ .name = "ia32_cmpneqpd" } },
+    .{ "__builtin_ia32_cmpneqps", .{ .name = "ia32_cmpneqps" } },
+    .{ "__builtin_ia32_cmpnlepd", .{ .name = "ia32_cmpnlepd" } },
+    .{ "__builtin_ia32_cmpnleps", .{ .name = "ia32_cmpnleps" } },
+    .{ "__builtin_ia32_cmpnltpd", .{ .name = "ia32_cmpnltpd" } },
+    .{ "__builtin_ia32_cmpnltps", .{ .name = "ia32_cmpnltps" } },
+    .{ "__builtin_ia32_cmpordpd", .{ .name = "ia32_cmpordpd" } },
+    .{ "__builtin_ia32_cmpordps", .{ .name = "ia32_cmpordps" } },
+    .{ "__builtin_ia32_cmppd", .{ .name = "ia32_cmppd" } },
+    .{ "__builtin_ia32_cmppd256", .{ .name = "ia32_cmppd256" } },
+    .{ "__builtin_ia32_cmpps", .{ .name = "ia32_cmpps" } },
+    .{ "__builtin_ia32_cmpps256", .{ .name = "ia32_cmpps256" } },
+    .{ "__builtin_ia32_cmpunordpd", .{ .name = "ia32_cmpunordpd" } },
+    .{ "__builtin_ia32_cmpunordps", .{ .name = "ia32_cmpunordps" } },
+    .{ "__builtin_ia32_cvttps2dq", .{ .name = "ia32_cvttps2dq" } },
+    .{ "__builtin_ia32_cvttps2dq256", .{ .name = "ia32_cvttps2dq256" } },
+    .{ "__builtin_ia32_maxpd", .{ .name = "ia32_maxpd" } },
+    .{ "__builtin_ia32_maxpd256", .{ .name = "ia32_maxpd256" } },
+    .{ "__builtin_ia32_maxps", .{ .name = "ia32_maxps" } },
+    .{ "__builtin_ia32_maxps256", .{ .name = "ia32_maxps256" } },
+    .{ "__builtin_ia32_minpd", .{ .name = "ia32_minpd" } },
+    .{ "__builtin_ia32_minpd256", .{ .name = "ia32_minpd256" } },
+    .{ "__builtin_ia32_minps", .{ .name = "ia32_minps" } },
+    .{ "__builtin_ia32_minps256", .{ .name = "ia32_minps256" } },
+    .{ "__builtin_ia32_movmskpd", .{ .name = "ia32_movmskpd" } },
+    .{ "__builtin_ia32_movmskpd256", .{ .name = "ia32_movmskpd256" } },
+    .{ "__builtin_ia32_movmskps", .{ .name = "ia32_movmskps" } },
+    .{ "__builtin_ia32_movmskps256", .{ .name = "ia32_movmskps256" } },
+    .{ "__builtin_ia32_packssdw128", .{ .name = "ia32_packssdw128" } },
+    .{ "__builtin_ia32_packsswb128", .{ .name = "ia32_packsswb128" } },
+    .{ "__builtin_ia32_packuswb128", .{ .name = "ia32_packuswb128" } },
+    .{ "__builtin_ia32_paddsb128", .{ .name = "ia32_paddsb128" } },
+    .{ "__builtin_ia32_paddsw128", .{ .name = "ia32_paddsw128" } },
+    .{ "__builtin_ia32_paddusb128", .{ .name = "ia32_paddusb128" } },
+    .{ "__builtin_ia32_paddusw128", .{ .name = "ia32_paddusw128" } },
+    .{ "__builtin_ia32_pause", .{ .name = "ia32_pause" } },
+    .{ "__builtin_ia32_pavgb128", .{ .name = "ia32_pavgb128" } },
+    .{ "__builtin_ia32_pavgb256", .{ .name = "ia32_pavgb256" } },
+    .{ "__builtin_ia32_pavgw128", .{ .name = "ia32_pavgw128" } },
+    .{ "__builtin_ia32_pavgw256", .{ .name = "ia32_pavgw256" } },
+    .{ "__builtin_ia32_pmaddwd128", .{ .name = "ia32_pmaddwd128" } },
+    .{ "__builtin_ia32_pmaddwd256", .{ .name = "ia32_pmaddwd256" } },
+    .{ "__builtin_ia32_pmaxsw128", .{ .name = "ia32_pmaxsw128" } },
+    .{ "__builtin_ia32_pmaxub128", .{ .name = "ia32_pmaxub128" } },
+    .{ "__builtin_ia32_pminsw128", .{ .name = "ia32_pminsw128" } },
+    .{ "__builtin_ia32_pminub128", .{ .name = "ia32_pminub128" } },
+    .{ "__builtin_ia32_pmovmskb128", .{ .name = "ia32_pmovmskb128" } },
+    .{ "__builtin_ia32_pmovmskb256", .{ .name = "ia32_pmovmskb256" } },
+    .{ "__builtin_ia32_pmulhuw128", .{ .name = "ia32_pmulhuw128" } },
+    .{ "__builtin_ia32_pmulhuw256", .{ .name = "ia32_pmulhuw256" } },
+    .{ "__builtin_ia32_pmulhw128", .{ .name = "ia32_pmulhw128" } },
+    .{ "__builtin_ia32_pmulhw256", .{ .name = "ia32_pmulhw256" } },
+    .{ "__builtin_ia32_pmuludq128", .{ .name = "ia32_pmuludq128" } },
+    .{ "__builtin_ia32_pmuludq256", .{ .name = "ia32_pmuludq256" } },
+    .{ "__builtin_ia32_psadbw128", .{ .name = "ia32_psadbw128" } },
+    .{ "__builtin_ia32_psadbw256", .{ .name = "ia32_psadbw256" } },
+    .{ "__builtin_ia32_pslldi128", .{ .name = "ia32_pslldi128" } },
+    .{ "__builtin_ia32_pslldi256", .{ .name = "ia32_pslldi256" } },
+    .{ "__builtin_ia32_psllqi128", .{ .name = "ia32_psllqi128" } },
+    .{ "__builtin_ia32_psllqi256", .{ .name = "ia32_psllqi256" } },
+    .{ "__builtin_ia32_psllwi128", .{ .name = "ia32_psllwi128" } },
+    .{ "__builtin_ia32_psllwi256", .{ .name = "ia32_psllwi256" } },
+    .{ "__builtin_ia32_psradi128", .{ .name = "ia32_psradi128" } },
+    .{ "__builtin_ia32_psradi256", .{ .name = "ia32_psradi256" } },
+    .{ "__builtin_ia32_psrawi128", .{ .name = "ia32_psrawi128" } },
+    .{ "__builtin_ia32_psrawi256", .{ .name = "ia32_psrawi256" } },
+    .{ "__builtin_ia32_psrldi128", .{ .name = "ia32_psrldi128" } },
+    .{ "__builtin_ia32_psrldi256", .{ .name = "ia32_psrldi256" } },
+    .{ "__builtin_ia32_psrlqi128", .{ .name = "ia32_psrlqi128" } },
+    .{ "__builtin_ia32_psrlqi256", .{ .name = "ia32_psrlqi256" } },
+    .{ "__builtin_ia32_psrlwi128", .{ .name = "ia32_psrlwi128" } },
+    .{ "__builtin_ia32_psrlwi256", .{ .name = "ia32_psrlwi256" } },
+    .{ "__builtin_ia32_psubsb128", .{ .name = "ia32_psubsb128" } },
+    .{ "__builtin_ia32_psubsw128", .{ .name = "ia32_psubsw128" } },
+    .{ "__builtin_ia32_psubusb128", .{ .name = "ia32_psubusb128" } },
+    .{ "__builtin_ia32_psubusw128", .{ .name = "ia32_psubusw128" } },
+    .{ "__builtin_ia32_rcpps", .{ .name = "ia32_rcpps" } },
+    .{ "__builtin_ia32_rcpps256", .{ .name = "ia32_rcpps256" } },
+    .{ "__builtin_ia32_rsqrtps", .{ .name = "ia32_rsqrtps" } },
+    .{ "__builtin_ia32_rsqrtps256", .{ .name = "ia32_rsqrtps256" } },
+    .{ "__builtin_ia32_sqrtpd", .{ .name = "ia32_sqrtpd" } },
+    .{ "__builtin_ia32_sqrtpd256", .{ .name = "ia32_sqrtpd256" } },
+    .{ "__builtin_ia32_sqrtps", .{ .name = "ia32_sqrtps" } },
+    .{ "__builtin_ia32_sqrtps256", .{ .name = "ia32_sqrtps256" } },
     .{ "__builtin_inff", .{ .name = "inff" } },
     .{ "__builtin_isinf_sign", .{ .name = "isinf_sign" } },
     .{ "__builtin_isinf", .{ .name = "isinf" } },
@@ -46,14 +147,45 @@ pub const map = std.StaticStringMap(Builtin).initComptime([_]struct { []const u8
     .{ "__builtin_log2", .{ .name = "log2", .tag = .log2 } },
     .{ "__builtin_logf", .{ .name = "logf", .tag = .log } },
     .{ "__builtin_log", .{ .name = "log", .tag = .log } },
+    .{ "__builtin_memchr", .{ .name = "memchr" } },
+    .{ "__builtin_memcmp", .{ .name = "memcmp" } },
     .{ "__builtin___memcpy_chk", .{ .name = "memcpy_chk" } },
     .{ "__builtin_memcpy", .{ .name = "memcpy" } },
+    .{ "__builtin___memmove_chk", .{ .name = "memmove_chk" } },
+    .{ "__builtin_memmove", .{ .name = "memmove" } },
     .{ "__builtin___memset_chk", .{ .name = "memset_chk" } },
     .{ "__builtin_memset", .{ .name = "memset" } },
     .{ "__builtin_mul_overflow", .{ .name = "mul_overflow" } },
     .{ "__builtin_nanf", .{ .name = "nanf" } },
+    .{ "__builtin_neon_vabs_v", .{ .name = "neon_vabs_v" } },
+    .{ "__builtin_neon_vabsq_v", .{ .name = "neon_vabsq_v" } },
+    .{ "__builtin_neon_vaddvq_f32", .{ .name = "neon_vaddvq_f32" } },
+    .{ "__builtin_neon_vaddvq_s32", .{ .name = "neon_vaddvq_s32" } },
+    .{ "__builtin_neon_vaddvq_u32", .{ .name = "neon_vaddvq_u32" } },
+    .{ "__builtin_neon_vld1_v", .{ .name = "neon_vld1_v" } },
+    .{ "__builtin_neon_vld1q_v", .{ .name = "neon_vld1q_v" } },
+    .{ "__builtin_neon_vmax_v", .{ .name = "neon_vmax_v" } },
+    .{ "__builtin_neon_vmaxq_v", .{ .name = "neon_vmaxq_v" } },
+    .{ "__builtin_neon_vmin_v", .{ .name = "neon_vmin_v" } },
+    .{ "__builtin_neon_vminq_v", .{ .name = "neon_vminq_v" } },
+    .{ "__builtin_neon_vqadd_v", .{ .name = "neon_vqadd_v" } },
+    .{ "__builtin_neon_vqaddq_v", .{ .name = "neon_vqaddq_v" } },
+    .{ "__builtin_neon_vqsub_v", .{ .name = "neon_vqsub_v" } },
+    .{ "__builtin_neon_vqsubq_v", .{ .name = "neon_vqsubq_v" } },
+    .{ "__builtin_neon_vst1_v", .{ .name = "neon_vst1_v" } },
+    .{ "__builtin_neon_vst1q_v", .{ .name = "neon_vst1q_v" } },
     .{ "__builtin_object_size", .{ .name = "object_size" } },
     .{ "__builtin_popcount", .{ .name = "popcount" } },
+    .{ "__builtin_popcountl", .{ .name = "popcountl" } },
+    .{ "__builtin_popcountll", .{ .name = "popcountll" } },
+    .{ "__builtin_prefetch", .{ .name = "prefetch" } },
+    .{ "__builtin_reduce_add", .{ .name = "reduce_add" } },
+    .{ "__builtin_reduce_and", .{ .name = "reduce_and" } },
+    .{ "__builtin_reduce_max", .{ .name = "reduce_max" } },
+    .{ "__builtin_reduce_min", .{ .name = "reduce_min" } },
+    .{ "__builtin_reduce_mul", .{ .name = "reduce_mul" } },
+    .{ "__builtin_reduce_or", .{ .name = "reduce_or" } },
+    .{ "__builtin_reduce_xor", .{ .name = "reduce_xor" } },
     .{ "__builtin_roundf", .{ .name = "roundf", .tag = .round } },
     .{ "__builtin_round", .{ .name = "round", .tag = .round } },
     .{ "__builtin_signbitf", .{ .name = "signbitf" } },
@@ -64,6 +196,7 @@ pub const map = std.StaticStringMap(Builtin).initComptime([_]struct { []const u8
     .{ "__builtin_sqrt", .{ .name = "sqrt", .tag = .sqrt } },
     .{ "__builtin_strcmp", .{ .name = "strcmp" } },
     .{ "__builtin_strlen", .{ .name = "strlen" } },
+    .{ "__builtin_sub_overflow", .{ .name = "sub_overflow" } },
     .{ "__builtin_truncf", .{ .name = "truncf", .tag = .trunc } },
     .{ "__builtin_trunc", .{ .name = "trunc", .tag = .trunc } },
     .{ "__builtin_unreachable", .{ .name = "unreachable", .tag = .@"unreachable" } },
@@ -135,6 +135,51 @@ test shuffleVectorIndex {
     try testing.expect(shuffleVectorIndex(7, vector_len) == -4);
 }
 
+const vectorMask = helpers.vectorMask;
+
+test vectorMask {
+    const V = @Vector(4, i16);
+    const a: V = .{ 1, 2, 3, 4 };
+    const b: V = .{ 4, 2, 1, 4 };
+
+    try testing.expectEqual(V{ -1, 0, 0, 0 }, vectorMask(V, a < b));
+    try testing.expectEqual(V{ 0, -1, 0, -1 }, vectorMask(V, a == b));
+}
+
+const signedOffset = helpers.signedOffset;
+
+test signedOffset {
+    const array = [_]u8{ 1, 2, 3, 4 };
+
+    try testing.expectEqual(@as(usize, 2), signedOffset(@as(c_int, 2)));
+    try testing.expectEqual(@as(usize, math.maxInt(usize)), signedOffset(@as(c_int, -1)));
+    try testing.expectEqual(@as(usize, math.maxInt(usize) - 2), signedOffset(@as(c_long, -3)));
+    try testing.expectEqual(@as(u8, 3), array[signedOffset(@as(c_short, 2))]);
+}
+
+const bf16ToFloat = helpers.bf16ToFloat;
+
+test bf16ToFloat {
+    try testing.expectEqual(@as(f32, 1.0), bf16ToFloat(f32, @enumFromInt(0x3f80)));
+    try testing.expectEqual(@as(f64, -2.5), bf16ToFloat(f64, @enumFromInt(0xc020)));
+    try testing.expect(math.isPositiveInf(bf16ToFloat(f32, @enumFromInt(0x7f80))));
+}
+
+const floatToBf16 = helpers.floatToBf16;
+
+test floatToBf16 {
+    try testing.expectEqual(@as(u16, 0x3f80), @intFromEnum(floatToBf16(1.0)));
+    try testing.expectEqual(@as(u16, 0x4040), @intFromEnum(floatToBf16(@as(c_int, 3))));
+    // 1 + 2^-8 is halfway between two bfloat16 values and rounds to even.
+    try testing.expectEqual(@as(u16, 0x3f80), @intFromEnum(floatToBf16(@as(f32, 1.00390625))));
+    try testing.expectEqual(@as(u16, 0x3f82), @intFromEnum(floatToBf16(@as(f32, 1.01171875))));
+    // Just above halfway, but rounding to f32 first would make it a tie.
+    try testing.expectEqual(@as(u16, 0x3f81), @intFromEnum(floatToBf16(@as(f64, 1.00390625 + 0x1p-30))));
+    try testing.expectEqual(@as(u16, 0xbf81), @intFromEnum(floatToBf16(@as(f64, -1.00390625 - 0x1p-30))));
+    try testing.expectEqual(@as(u16, 0x7f80), @intFromEnum(floatToBf16(math.floatMax(f32))));
+    try testing.expect(math.isNan(bf16ToFloat(f32, floatToBf16(math.nan(f64)))));
+}
+
 const FlexibleArrayType = helpers.FlexibleArrayType;
 
 test FlexibleArrayType {
@@ -3,6 +3,9 @@ const assert = std.debug.assert;
 const mem = std.mem;
 const process = std.process;
 const aro = @import("aro");
+const CountingAllocator = @import("CountingAllocator.zig");
+const Profiler = @import("Profiler.zig");
+const Stats = @import("Stats.zig");
 const Translator = @import("Translator.zig");
 
 const fast_exit = @import("builtin").mode != .Debug;
@@ -91,6 +94,34 @@ pub const usage =
     \\  --version           Print translate-c version
     \\  -fmodule-libs       Import libraries as modules
     \\  -fno-module-libs    (default) Install libraries next to output file
+    \\  -finline-static-fns Translate static inline functions as inline fns
+    \\  -fno-inline-static-fns
+    \\                      (default) Translate static inline functions as regular fns
+    \\  -fhoist-static-locals
+    \\                      Translate static local variables as file scope variables
+    \\  -fno-hoist-static-locals
+    \\                      (default) Wrap static local variables in a local struct
+    \\  -fsplit-output      Write the declarations of each header to a separate file
+    \\                      next to the output file, which re-exports them
+    \\  -fno-split-output   (default) Write all declarations to the output file
+    \\  -ftime-report[=N]   Print the time spent in each phase and the N (default 10)
+    \\                      slowest declarations and macros to stderr
+    \\  --trace-out=<file>  Write a Chrome Trace Event file with a span for each
+    \\                      phase, declaration, function and macro
+    \\  --stats=<file>      Write a JSON report of demoted functions, records demoted
+    \\                      to opaque types and failed declarations and macros
+    \\  --names-out=<file>  Write the translated headers and the names of the public
+    \\                      declarations to <file>, for use as --base-names of
+    \\                      translations including this one
+    \\  --base-module=<name> --base-names=<file>
+    \\                      Alias the declarations named in <file> from the module
+    \\                      <name> instead of translating them again, if they come
+    \\                      from a header listed in <file>
+    \\  --batch=<file>      Translate every file listed in <file> into the directory
+    \\                      given by -o. Each line names a file relative to <file>,
+    \\                      optionally followed by tab separated -f options. Files
+    \\                      with errors get an output noting it and do not change the
+    \\                      exit status; their count is reported as a warning
     \\
     \\
 ;
@@ -99,6 +130,16 @@ fn translate(d: *aro.Driver, tc: *aro.Toolchain, args: [][:0]u8) !void {
     const gpa = d.comp.gpa;
 
     var module_libs = false;
+    var inline_static_fns = false;
+    var hoist_static_locals = false;
+    var split_output = false;
+    var time_report: ?usize = null;
+    var trace_out: ?[]const u8 = null;
+    var stats_out: ?[]const u8 = null;
+    var batch_path: ?[]const u8 = null;
+    var names_out: ?[]const u8 = null;
+    var base_module: ?[]const u8 = null;
+    var base_names: ?[]const u8 = null;
 
     const aro_args = args: {
         var i: usize = 0;
@@ -121,6 +162,36 @@ fn translate(d: *aro.Driver, tc: *aro.Toolchain, args: [][:0]u8) !void {
                 module_libs = true;
             } else if (mem.eql(u8, arg, "-fno-module-libs")) {
                 module_libs = false;
+            } else if (mem.eql(u8, arg, "-finline-static-fns")) {
+                inline_static_fns = true;
+            } else if (mem.eql(u8, arg, "-fno-inline-static-fns")) {
+                inline_static_fns = false;
+            } else if (mem.eql(u8, arg, "-fhoist-static-locals")) {
+                hoist_static_locals = true;
+            } else if (mem.eql(u8, arg, "-fno-hoist-static-locals")) {
+                hoist_static_locals = false;
+            } else if (mem.eql(u8, arg, "-fsplit-output")) {
+                split_output = true;
+            } else if (mem.eql(u8, arg, "-fno-split-output")) {
+                split_output = false;
+            } else if (mem.eql(u8, arg, "-ftime-report")) {
+                time_report = 10;
+            } else if (mem.startsWith(u8, arg, "-ftime-report=")) {
+                const count = arg["-ftime-report=".len..];
+                time_report = std.fmt.parseInt(usize, count, 10) catch
+                    return d.fatal("invalid -ftime-report count '{s}'", .{count});
+            } else if (mem.startsWith(u8, arg, "--trace-out=")) {
+                trace_out = arg["--trace-out=".len..];
+            } else if (mem.startsWith(u8, arg, "--stats=")) {
+                stats_out = arg["--stats=".len..];
+            } else if (mem.startsWith(u8, arg, "--batch=")) {
+                batch_path = arg["--batch=".len..];
+            } else if (mem.startsWith(u8, arg, "--names-out=")) {
+                names_out = arg["--names-out=".len..];
+            } else if (mem.startsWith(u8, arg, "--base-module=")) {
+                base_module = arg["--base-module=".len..];
+            } else if (mem.startsWith(u8, arg, "--base-names=")) {
+                base_names = arg["--base-names=".len..];
             } else {
                 i += 1;
             }
@@ -144,23 +215,85 @@ fn translate(d: *aro.Driver, tc: *aro.Toolchain, args: [][:0]u8) !void {
         break :macros try d.comp.addSourceFromOwnedBuffer("<command line>", content, .user);
     };
 
-    if (d.inputs.items.len != 1) {
+    if (batch_path != null) {
+        if (d.inputs.items.len != 0) {
+            return d.fatal("input files cannot be combined with --batch", .{});
+        }
+        if (d.output_name == null) {
+            return d.fatal("--batch requires an output directory given with -o", .{});
+        }
+        if (time_report != null or trace_out != null or stats_out != null or names_out != null or split_output) {
+            return d.fatal("--batch cannot be combined with -ftime-report, --trace-out, --stats, --names-out or -fsplit-output", .{});
+        }
+    } else if (d.inputs.items.len != 1) {
         return d.fatal("expected exactly one input file", .{});
     }
-    const source = d.inputs.items[0];
+    if (split_output and (d.output_name == null or mem.eql(u8, d.output_name.?, "-"))) {
+        return d.fatal("-fsplit-output requires an output file given with -o", .{});
+    }
+    if ((base_module == null) != (base_names == null)) {
+        return d.fatal("--base-module and --base-names must be given together", .{});
+    }
+
+    var base: Translator.Base = .{ .module = base_module orelse "", .names = .empty };
+    defer base.names.deinit(gpa);
+    defer base.sources.deinit(gpa);
+    var base_names_buf: ?[]u8 = null;
+    defer if (base_names_buf) |buf| gpa.free(buf);
+    if (base_names) |path| {
+        const max_names_size = 64 * 1024 * 1024;
+        const buf = std.fs.cwd().readFileAlloc(path, gpa, .limited(max_names_size)) catch |err|
+            return d.fatal("unable to read base names '{s}': {s}", .{ path, aro.Driver.errorDescription(err) });
+        base_names_buf = buf;
+        var lines = mem.tokenizeAny(u8, buf, "\r\n");
+        while (lines.next()) |line| {
+            if (line[0] == '#') {
+                try base.sources.put(gpa, line[1..], {});
+            } else {
+                try base.names.put(gpa, line, {});
+            }
+        }
+    }
+    const base_ptr: ?*const Translator.Base = if (base_names != null) &base else null;
+
+    var profiler_instance: Profiler = undefined;
+    const profiler: ?*Profiler = if (time_report != null or trace_out != null) profiler: {
+        profiler_instance = Profiler.init(gpa) catch
+            return d.fatal("-ftime-report and --trace-out are not supported on this system", .{});
+        break :profiler &profiler_instance;
+    } else null;
+    defer if (profiler) |p| p.deinit();
+
+    var stats_instance: Stats = .init(gpa);
+    defer stats_instance.deinit();
 
+    // Count the allocations of each subsystem whenever a report is requested.
+    var memory: CountingAllocator = .init(gpa);
+    const count_memory = time_report != null or stats_out != null;
+
+    if (profiler) |p| p.beginPhase();
     tc.discover() catch |er| switch (er) {
         error.OutOfMemory => return error.OutOfMemory,
         error.TooManyMultilibs => return d.fatal("found more than one multilib with the same priority", .{}),
     };
     try tc.defineSystemIncludes();
     try d.comp.initSearchPath(d.includes.items, d.verbose_search_path);
+    if (profiler) |p| p.endPhase(.toolchain);
 
     const builtin_macros = d.comp.generateBuiltinMacros(d.system_defines) catch |err| switch (err) {
         error.FileTooBig => return d.fatal("builtin macro source exceeded max size", .{}),
         else => |e| return e,
     };
 
+    if (batch_path) |path| {
+        return translateBatch(d, path, .{
+            .module_libs = module_libs,
+            .inline_static_fns = inline_static_fns,
+            .hoist_static_locals = hoist_static_locals,
+        }, base_ptr, builtin_macros, user_macros);
+    }
+    const source = d.inputs.items[0];
+
     var pp = try aro.Preprocessor.initDefault(d.comp);
     defer pp.deinit();
 
@@ -170,6 +303,7 @@ fn translate(d: *aro.Driver, tc: *aro.Toolchain, args: [][:0]u8) !void {
 
     if (opt_dep_file) |*dep_file| pp.dep_file = dep_file;
 
+    if (profiler) |p| p.beginPhase();
     try pp.preprocessSources(.{
         .main = source,
         .builtin = builtin_macros,
@@ -177,9 +311,12 @@ fn translate(d: *aro.Driver, tc: *aro.Toolchain, args: [][:0]u8) !void {
         .imacros = d.imacros.items,
         .implicit_includes = d.implicit_includes.items,
     });
+    if (profiler) |p| p.endPhase(.preprocess);
 
+    if (profiler) |p| p.beginPhase();
     var c_tree = try pp.parse();
     defer c_tree.deinit();
+    if (profiler) |p| p.endPhase(.parse);
 
     if (d.diagnostics.errors != 0) {
         if (fast_exit) process.exit(1);
@@ -202,15 +339,34 @@ fn translate(d: *aro.Driver, tc: *aro.Toolchain, args: [][:0]u8) !void {
             return d.fatal("unable to write dependency file: {s}", .{aro.Driver.errorDescription(file_writer.err.?)});
     }
 
+    var names: std.Io.Writer.Allocating = .init(gpa);
+    defer names.deinit();
+
+    var split: Translator.Split = .{ .root_name = if (split_output) std.fs.path.basename(d.output_name.?) else "" };
+    defer split.deinit(gpa);
+
     const rendered_zig = try Translator.translate(.{
         .gpa = gpa,
         .comp = d.comp,
         .pp = &pp,
         .tree = &c_tree,
         .module_libs = module_libs,
+        .inline_static_fns = inline_static_fns,
+        .hoist_static_locals = hoist_static_locals,
+        .profiler = profiler,
+        .stats = if (stats_out != null) &stats_instance else null,
+        .memory = if (count_memory) &memory else null,
+        .base = base_ptr,
+        .names_out = if (names_out != null) &names.writer else null,
+        .split = if (split_output) &split else null,
     });
     defer gpa.free(rendered_zig);
 
+    if (names_out) |path| {
+        std.fs.cwd().writeFile(.{ .sub_path = path, .data = names.written() }) catch |err|
+            return d.fatal("failed to write names to '{s}': {s}", .{ path, aro.Driver.errorDescription(err) });
+    }
+
     var close_out_file = false;
     var out_file_path: []const u8 = "<stdout>";
     var out_file: std.fs.File = .stdout();
@@ -229,11 +385,53 @@ fn translate(d: *aro.Driver, tc: *aro.Toolchain, args: [][:0]u8) !void {
         out_file_path = path;
     }
 
+    if (profiler) |p| p.beginPhase();
     var out_writer = out_file.writer(&out_buf);
     out_writer.interface.writeAll(rendered_zig) catch {};
     out_writer.interface.flush() catch {};
     if (out_writer.err) |write_err|
         return d.fatal("failed to write result to '{s}': {s}", .{ out_file_path, aro.Driver.errorDescription(write_err) });
+    for (split.files.items) |file| {
+        const path = try std.fs.path.join(gpa, &.{ std.fs.path.dirname(out_file_path) orelse "", file.name });
+        defer gpa.free(path);
+        std.fs.cwd().writeFile(.{ .sub_path = path, .data = file.source }) catch |err|
+            return d.fatal("failed to write result to '{s}': {s}", .{ path, aro.Driver.errorDescription(err) });
+    }
+    if (profiler) |p| p.endPhase(.write_output);
+
+    if (trace_out) |path| {
+        const file = std.fs.cwd().createFile(path, .{}) catch |err|
+            return d.fatal("failed to create trace file '{s}': {s}", .{ path, aro.Driver.errorDescription(err) });
+        defer file.close();
+
+        var file_writer = file.writer(&out_buf);
+        profiler.?.writeTrace(d.comp, &file_writer.interface) catch {};
+        file_writer.interface.flush() catch {};
+        if (file_writer.err) |write_err|
+            return d.fatal("failed to write trace file '{s}': {s}", .{ path, aro.Driver.errorDescription(write_err) });
+    }
+
+    if (stats_out) |path| {
+        const file = std.fs.cwd().createFile(path, .{}) catch |err|
+            return d.fatal("failed to create stats file '{s}': {s}", .{ path, aro.Driver.errorDescription(err) });
+        defer file.close();
+
+        var file_writer = file.writer(&out_buf);
+        stats_instance.write(d.comp, &memory, &file_writer.interface) catch |err| switch (err) {
+            error.OutOfMemory => return error.OutOfMemory,
+            error.WriteFailed => {},
+        };
+        file_writer.interface.flush() catch {};
+        if (file_writer.err) |write_err|
+            return d.fatal("failed to write stats file '{s}': {s}", .{ path, aro.Driver.errorDescription(write_err) });
+    }
+
+    if (time_report) |top| {
+        var stderr_buf: [1024]u8 = undefined;
+        var stderr = std.fs.File.stderr().writer(&stderr_buf);
+        profiler.?.writeReport(d.comp, &memory, &stderr.interface, top) catch {};
+        stderr.interface.flush() catch {};
+    }
 
     if (!module_libs) {
         const dest_path = if (d.output_name) |path| std.fs.path.dirname(path) else null;
@@ -244,6 +442,126 @@ fn translate(d: *aro.Driver, tc: *aro.Toolchain, args: [][:0]u8) !void {
     if (fast_exit) process.exit(0);
 }
 
+const FileOptions = struct {
+    module_libs: bool,
+    inline_static_fns: bool,
+    hoist_static_locals: bool,
+};
+
+/// Translates every file listed in the batch file at `batch_path`, reusing the toolchain, the
+/// search path and the builtin and command line macros set up for the first one. Files which
+/// fail to parse are reported and skipped so that the rest of the batch is still translated.
+fn translateBatch(
+    d: *aro.Driver,
+    batch_path: []const u8,
+    defaults: FileOptions,
+    base: ?*const Translator.Base,
+    builtin_macros: aro.Source,
+    user_macros: aro.Source,
+) !void {
+    const gpa = d.comp.gpa;
+    const max_batch_size = 16 * 1024 * 1024;
+
+    const batch = std.fs.cwd().readFileAlloc(batch_path, gpa, .limited(max_batch_size)) catch |err|
+        return d.fatal("unable to read batch file '{s}': {s}", .{ batch_path, aro.Driver.errorDescription(err) });
+    defer gpa.free(batch);
+
+    const base_dir = std.fs.path.dirname(batch_path) orelse ".";
+    const out_dir = d.output_name.?;
+    // Pragmas such as `#pragma GCC diagnostic` change the diagnostics state, so every
+    // file starts from the state given on the command line.
+    const initial_state = d.diagnostics.state;
+    var failed: usize = 0;
+
+    var lines = mem.tokenizeScalar(u8, batch, '\n');
+    while (lines.next()) |line| {
+        var fields = mem.tokenizeScalar(u8, mem.trimRight(u8, line, "\r"), '\t');
+        const input = fields.next() orelse continue;
+
+        var options = defaults;
+        while (fields.next()) |flag| {
+            if (mem.eql(u8, flag, "-finline-static-fns")) {
+                options.inline_static_fns = true;
+            } else if (mem.eql(u8, flag, "-fno-inline-static-fns")) {
+                options.inline_static_fns = false;
+            } else if (mem.eql(u8, flag, "-fhoist-static-locals")) {
+                options.hoist_static_locals = true;
+            } else if (mem.eql(u8, flag, "-fno-hoist-static-locals")) {
+                options.hoist_static_locals = false;
+            } else {
+                return d.fatal("unsupported option '{s}' for '{s}' in batch file", .{ flag, input });
+            }
+        }
+
+        const input_path = try std.fs.path.join(gpa, &.{ base_dir, input });
+        defer gpa.free(input_path);
+        const output_name = try std.fmt.allocPrint(gpa, "{s}.zig", .{input[0 .. input.len - std.fs.path.extension(input).len]});
+        defer gpa.free(output_name);
+        const output_path = try std.fs.path.join(gpa, &.{ out_dir, output_name });
+        defer gpa.free(output_path);
+
+        const source = d.comp.addSourceFromPath(input_path) catch |err|
+            return d.fatal("unable to read '{s}': {s}", .{ input_path, aro.Driver.errorDescription(err) });
+
+        d.diagnostics.state = initial_state;
+        var pp = try aro.Preprocessor.initDefault(d.comp);
+        defer pp.deinit();
+
+        const errors = d.diagnostics.errors;
+        try pp.preprocessSources(.{
+            .main = source,
+            .builtin = builtin_macros,
+            .command_line = user_macros,
+            .imacros = d.imacros.items,
+            .implicit_includes = d.implicit_includes.items,
+        });
+
+        var c_tree = try pp.parse();
+        defer c_tree.deinit();
+
+        if (std.fs.path.dirname(output_path)) |dirname| {
+            std.fs.cwd().makePath(dirname) catch |err|
+                return d.fatal("failed to create path to '{s}': {s}", .{ output_path, aro.Driver.errorDescription(err) });
+        }
+
+        // A file with errors only fails itself; its output says so instead of being missing.
+        if (d.diagnostics.errors != errors) {
+            d.diagnostics.errors = errors;
+            failed += 1;
+            const message = try std.fmt.allocPrint(gpa, "// translate-c: errors were reported for '{s}'\n", .{input});
+            defer gpa.free(message);
+            std.fs.cwd().writeFile(.{ .sub_path = output_path, .data = message }) catch |err|
+                return d.fatal("failed to write result to '{s}': {s}", .{ output_path, aro.Driver.errorDescription(err) });
+            continue;
+        }
+
+        const rendered_zig = try Translator.translate(.{
+            .gpa = gpa,
+            .comp = d.comp,
+            .pp = &pp,
+            .tree = &c_tree,
+            .module_libs = options.module_libs,
+            .inline_static_fns = options.inline_static_fns,
+            .hoist_static_locals = options.hoist_static_locals,
+            .base = base,
+        });
+        defer gpa.free(rendered_zig);
+
+        std.fs.cwd().writeFile(.{ .sub_path = output_path, .data = rendered_zig }) catch |err|
+            return d.fatal("failed to write result to '{s}': {s}", .{ output_path, aro.Driver.errorDescription(err) });
+    }
+
+    if (!defaults.module_libs) {
+        installLibs(d, out_dir) catch |err|
+            return d.fatal("failed to install library files: {s}", .{aro.Driver.errorDescription(err)});
+    }
+    if (failed != 0) {
+        // Reported as a warning so that -w silences it and -Werror fails the batch.
+        d.diagnostics.state = initial_state;
+        try d.warn("{d} file(s) in '{s}' had errors", .{ failed, batch_path });
+    }
+}
+
 fn installLibs(d: *aro.Driver, dest_path: ?[]const u8) !void {
     const gpa = d.comp.gpa;
     const cwd = std.fs.cwd();
@@ -281,5 +599,8 @@ comptime {
         _ = Translator;
         _ = @import("helpers.zig");
         _ = @import("PatternList.zig");
+        _ = CountingAllocator;
+        _ = Profiler;
+        _ = Stats;
     }
 }
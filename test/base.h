@@ -0,0 +1,17 @@
+#define BASE_VERSION 3
+#define BASE_SQUARE(x) ((x) * (x))
+
+typedef struct {
+    int x, y;
+} Point;
+
+struct base_list {
+    struct base_list *next;
+    int value;
+};
+
+enum base_color { BASE_RED, BASE_GREEN };
+
+static inline int base_dot(Point a, Point b) {
+    return a.x * b.x + a.y * b.y;
+}
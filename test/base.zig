@@ -0,0 +1,34 @@
+const std = @import("std");
+const expect = std.testing.expect;
+const expectEqual = std.testing.expectEqual;
+
+const base = @import("base.h");
+const derived = @import("derived.h");
+
+test "declarations of the base are aliased" {
+    try expect(derived.Point == base.Point);
+    try expect(derived.struct_base_list == base.struct_base_list);
+    try expectEqual(base.BASE_GREEN, derived.BASE_GREEN);
+}
+
+test "unreferenced declarations of the base are not re-exported" {
+    try expect(!@hasDecl(derived, "BASE_SQUARE"));
+    try expect(!@hasDecl(derived, "base_dot"));
+    try expectEqual(@as(c_int, 25), base.BASE_SQUARE(@as(c_int, 5)));
+    try expectEqual(@as(c_int, 11), base.base_dot(.{ .x = 1, .y = 2 }, .{ .x = 3, .y = 4 }));
+}
+
+test "macros redefined by the derived header are not taken from the base" {
+    try expectEqual(@as(c_int, 3), base.BASE_VERSION);
+    try expectEqual(@as(c_int, 4), derived.BASE_VERSION);
+}
+
+test "derived declarations use the types of the base" {
+    const rect: derived.Rect = .{ .min = .{ .x = 1, .y = 1 }, .max = .{ .x = 4, .y = 3 } };
+    try expectEqual(@as(c_int, 6), derived.rect_area(rect));
+    try expectEqual(@as(c_int, 1), derived.rect_color());
+
+    var tail: base.struct_base_list = .{ .next = null, .value = 2 };
+    var head: base.struct_base_list = .{ .next = &tail, .value = 3 };
+    try expectEqual(@as(c_int, 5), derived.list_sum(&head));
+}
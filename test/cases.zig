@@ -37,6 +37,13 @@ pub fn lowerCases(
     };
     defer dir.close();
 
+    // The translate cases of each target are split into one batch per CPU, each translated by a
+    // single translate-c process, so that the batches run in parallel and a crash only fails
+    // the cases of one batch.
+    const shard_count = std.Thread.getCpuCount() catch 1;
+    var batches: std.StringArrayHashMapUnmanaged(Batch) = .empty;
+    var cases_per_target: std.StringHashMapUnmanaged(usize) = .empty;
+
     var it = dir.walk(b.allocator) catch |err| std.debug.panic("failed to walk cases: {s}", .{@errorName(err)});
     while (it.next() catch |err| {
         std.debug.panic("failed to walk cases: {s}", .{@errorName(err)});
@@ -45,31 +52,52 @@ pub fn lowerCases(
         const case = caseFromFile(b, entry) catch |err|
             std.debug.panic("failed to process case '{s}': {s}", .{ entry.path, @errorName(err) });
 
-        const source_file = b.addWriteFiles().add("tmp.c", case.input);
-
         const case_targets = if (case.target) |*t| t[0..1] else targets;
         for (case_targets) |case_target| {
-            if (case.skip_vector_index) continue;
             if (case.skip_windows and case_target.result.os.tag == .windows) {
                 continue;
             }
-            const name_and_triple = b.fmt("{s} {s}", .{
-                case_target.query.zigTriple(b.graph.arena) catch @panic("OOM"),
-                case.name,
-            });
-            const translator: Translator = .initInner(b, translator_conf, .{
-                .name = name_and_triple,
-                .c_source_file = source_file,
-                .target = case_target,
-                .optimize = optimize,
-            });
+            const triple = case_target.query.zigTriple(b.graph.arena) catch @panic("OOM");
+            const name_and_triple = b.fmt("{s} {s}", .{ triple, case.name });
             switch (case.kind) {
                 .translate => |output| {
-                    const check_file = b.addCheckFile(translator.output_file, .{ .expected_matches = output });
-                    check_file.step.name = b.fmt("check-translated {s}", .{name_and_triple});
-                    test_translate_step.dependOn(&check_file.step);
+                    const count = cases_per_target.getOrPutValue(b.allocator, triple, 0) catch @panic("OOM");
+                    const shard = count.value_ptr.* % shard_count;
+                    count.value_ptr.* += 1;
+                    const gop = batches.getOrPut(b.allocator, b.fmt("{s}-{d}", .{ triple, shard })) catch @panic("OOM");
+                    if (!gop.found_existing) gop.value_ptr.* = .{
+                        .target = case_target,
+                        .files = b.addWriteFiles(),
+                        .list = .empty,
+                        .checks = .empty,
+                    };
+                    const batch = gop.value_ptr;
+                    // Each input keeps the name `tmp.c`, which appears in expected diagnostics.
+                    const case_dir = entry.path[0 .. entry.path.len - std.fs.path.extension(entry.path).len];
+                    const path = b.pathJoin(&.{ case_dir, "tmp.c" });
+                    _ = batch.files.add(path, case.input);
+
+                    batch.list.appendSlice(b.allocator, path) catch @panic("OOM");
+                    if (case.inline_static_fns) batch.list.appendSlice(b.allocator, "\t-finline-static-fns") catch @panic("OOM");
+                    if (case.hoist_static_locals) batch.list.appendSlice(b.allocator, "\t-fhoist-static-locals") catch @panic("OOM");
+                    batch.list.append(b.allocator, '\n') catch @panic("OOM");
+
+                    batch.checks.append(b.allocator, .{
+                        .name = name_and_triple,
+                        .output_path = b.pathJoin(&.{ case_dir, "tmp.zig" }),
+                        .expected = output,
+                    }) catch @panic("OOM");
                 },
                 .run => |output| {
+                    const translator: Translator = .initInner(b, translator_conf, .{
+                        .name = name_and_triple,
+                        .c_source_file = b.addWriteFiles().add("tmp.c", case.input),
+                        .target = case_target,
+                        .optimize = optimize,
+                        .inline_static_fns = case.inline_static_fns,
+                        .hoist_static_locals = case.hoist_static_locals,
+                        .split_output = case.split_output,
+                    });
                     const exe = b.addExecutable(.{ .name = case.name, .root_module = translator.mod });
                     const run = b.addRunArtifact(exe);
                     run.step.name = b.fmt("run-translated {s}", .{name_and_triple});
@@ -80,8 +108,40 @@ pub fn lowerCases(
             }
         }
     }
+
+    for (batches.keys(), batches.values()) |name, batch| {
+        const translated = Translator.initBatch(b, translator_conf, .{
+            .name = name,
+            .batch_file = batch.files.add("batch", batch.list.items),
+            .target = batch.target,
+        });
+        for (batch.checks.items) |check| {
+            const check_file = b.addCheckFile(translated.output_dir.path(b, check.output_path), .{
+                .expected_matches = check.expected,
+            });
+            check_file.step.name = b.fmt("check-translated {s}", .{check.name});
+            test_translate_step.dependOn(&check_file.step);
+        }
+    }
 }
 
+/// A share of the translate cases of one target.
+const Batch = struct {
+    target: std.Build.ResolvedTarget,
+    /// Holds the input of every case next to the batch file listing them.
+    files: *std.Build.Step.WriteFiles,
+    /// The contents of the batch file.
+    list: std.ArrayList(u8),
+    checks: std.ArrayList(Check),
+
+    const Check = struct {
+        name: []const u8,
+        /// Relative to the output directory of the batch.
+        output_path: []const u8,
+        expected: []const []const u8,
+    };
+};
+
 const Case = struct {
     name: []const u8,
     /// This is an override; usually `null`.
@@ -89,7 +149,10 @@ const Case = struct {
     input: []const u8,
     kind: Kind,
     skip_windows: bool,
-    skip_vector_index: bool,
+    inline_static_fns: bool,
+    hoist_static_locals: bool,
+    /// Only supported by run cases.
+    split_output: bool,
 
     const Expect = enum { pass, fail };
 
@@ -124,7 +187,9 @@ fn caseFromFile(b: *std.Build, entry: std.fs.Dir.Walker.Entry) !Case {
 
     var target: ?std.Target.Query = null;
     var skip_windows = false;
-    var skip_vector_index = false;
+    var inline_static_fns = false;
+    var hoist_static_locals = false;
+    var split_output = false;
 
     var it = std.mem.tokenizeScalar(u8, manifest, '\n');
 
@@ -149,10 +214,15 @@ fn caseFromFile(b: *std.Build, entry: std.fs.Dir.Walker.Entry) !Case {
             target = try .parse(.{ .arch_os_abi = value });
         } else if (std.mem.eql(u8, key, "skip_windows")) {
             skip_windows = std.mem.eql(u8, value, "true");
-        } else if (std.mem.eql(u8, key, "skip_vector_index")) {
-            skip_vector_index = std.mem.eql(u8, value, "true");
+        } else if (std.mem.eql(u8, key, "inline_static_fns")) {
+            inline_static_fns = std.mem.eql(u8, value, "true");
+        } else if (std.mem.eql(u8, key, "hoist_static_locals")) {
+            hoist_static_locals = std.mem.eql(u8, value, "true");
+        } else if (std.mem.eql(u8, key, "split_output")) {
+            split_output = std.mem.eql(u8, value, "true");
         } else return error.InvalidTestConfigOption;
     }
+    if (split_output and kind != .run) return error.InvalidTestConfigOption;
 
     return .{
         .name = std.fs.path.stem(entry.basename),
@@ -163,7 +233,9 @@ fn caseFromFile(b: *std.Build, entry: std.fs.Dir.Walker.Entry) !Case {
             .translate => .{ .translate = try trailingSplit(b.allocator, &it) },
         },
         .skip_windows = skip_windows,
-        .skip_vector_index = skip_vector_index,
+        .inline_static_fns = inline_static_fns,
+        .hoist_static_locals = hoist_static_locals,
+        .split_output = split_output,
     };
 }
 
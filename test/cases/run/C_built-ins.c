@@ -122,8 +122,36 @@ int main(void) {
     __builtin_memset(s, 42, __builtin_strlen(s));
     if (s[0] != 42 || s[1] != 42 || s[2] != 42 || s[3] != 42 || s[4] != 42) abort();
 
+    __builtin_prefetch(s);
+    __builtin_prefetch(s, 1, 0);
+    char *aligned = __builtin_assume_aligned(s, 1);
+    if (aligned != s) abort();
+
     free(s);
 
+    if (__builtin_clzll(1) != 63) abort();
+    if (__builtin_ctzll(1ULL << 40) != 40) abort();
+    if (__builtin_popcountll(0xFFFFFFFFFFULL) != 40) abort();
+    if (__builtin_ctzl(4UL) != 2) abort();
+    if (__builtin_popcountl(0xFFUL) != 8) abort();
+
+    int r;
+    if (!__builtin_add_overflow(INT_MAX, 1, &r)) abort();
+    if (__builtin_add_overflow(40, 2, &r) || r != 42) abort();
+    if (!__builtin_sub_overflow(INT_MIN, 1, &r)) abort();
+    if (__builtin_sub_overflow(44, 2, &r) || r != 42) abort();
+
+    unsigned u;
+    if (__builtin_add_overflow(-1, 2, &u) || u != 1) abort();
+    if (!__builtin_sub_overflow(1, 2, &u) || u != UINT_MAX) abort();
+    if (!__builtin_add_overflow(UINT_MAX, 0, &r) || r != -1) abort();
+    if (__builtin_sub_overflow(UINT_MAX, UINT_MAX - 5U, &r) || r != 5) abort();
+    long long ll = LLONG_MAX;
+    if (__builtin_sub_overflow(ll, LLONG_MAX - 7, &r) || r != 7) abort();
+    if (!__builtin_add_overflow(ll, 1, &r) || r != 0) abort();
+    unsigned char c;
+    if (!__builtin_add_overflow(200, 100, &c) || c != 44) abort();
+
     return 0;
 }
 
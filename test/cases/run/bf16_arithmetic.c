@@ -0,0 +1,34 @@
+#include <stdlib.h>
+int main(void) {
+    __bf16 a = 1.5f;
+    __bf16 b = 2.25f;
+    __bf16 sum = a + b;
+    if ((float)sum != 3.75f) abort();
+    if ((float)(a * b) != 3.375f) abort();
+    if ((float)(b - a) != 0.75f) abort();
+    if (!(a < b) || a == b) abort();
+    // 1 + 2^-8 is not a bfloat16 value and rounds to even.
+    __bf16 one = 1.0f;
+    __bf16 tiny = 0.00390625f;
+    if ((float)(one + tiny) != 1.0f) abort();
+    double d = 1.00390625 + 0x1p-30;
+    __bf16 rounded = d;
+    if ((float)rounded != 1.0078125f) abort();
+
+    __bf16 x = 2.0f;
+    x = -x;
+    if ((float)x != -2.0f) abort();
+    x += 5.5f;
+    if ((float)x != 3.5f) abort();
+    x *= x;
+    if ((float)x != 12.25f) abort();
+    x++;
+    if ((float)x != 13.25f) abort();
+    __bf16 old = x--;
+    if ((float)old != 13.25f || (float)x != 12.25f) abort();
+    if ((float)++x != 13.25f) abort();
+    return 0;
+}
+
+// run
+// target=x86_64-linux
@@ -0,0 +1,31 @@
+#include <stdlib.h>
+struct S { char name[8]; int x; };
+int main(void) {
+    char buf[16];
+    char src[16] = "fortified";
+    struct S s = {0};
+    unsigned long n = 9;
+    char *p = buf;
+
+    __builtin___memset_chk(buf, 'x', sizeof(buf), __builtin_object_size(buf, 0));
+    __builtin___memcpy_chk(buf, src, 4, __builtin_object_size(buf, 0));
+    if (buf[3] != 't' || buf[4] != 'x') abort();
+    __builtin___memcpy_chk(buf, src, n + 1, __builtin_object_size(buf, 0));
+    if (buf[8] != 'd' || buf[9] != 0) abort();
+    __builtin___memmove_chk(buf + 1, buf, 4, __builtin_object_size(buf, 0));
+    if (buf[0] != 'f' || buf[1] != 'f' || buf[4] != 't') abort();
+    __builtin___memcpy_chk(p, src, n, __builtin_object_size(p, 0));
+    if (buf[8] != 'd') abort();
+
+    __builtin___memset_chk(s.name, 'y', sizeof(s.name), __builtin_object_size(s.name, 1));
+    if (s.name[7] != 'y' || s.x != 0) abort();
+
+    if (__builtin_object_size(buf, 0) != 16) abort();
+    if (__builtin_object_size(&s, 0) != sizeof(struct S)) abort();
+    if (__builtin_object_size(s.name, 1) != 8) abort();
+    if (__builtin_object_size(p, 0) != (unsigned long)-1) abort();
+    if (__builtin_object_size(p, 2) != 0) abort();
+    return 0;
+}
+
+// run
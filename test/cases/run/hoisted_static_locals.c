@@ -0,0 +1,25 @@
+#include <stdlib.h>
+static int next_id(void) {
+    static int id;
+    return ++id;
+}
+static int next_even(void) {
+    static int id = 0;
+    id += 2;
+    return id;
+}
+static int *shared(void) {
+    static int value = 7;
+    static int *ptr = &value;
+    return ptr;
+}
+int main(void) {
+    if (next_id() != 1 || next_id() != 2) abort();
+    if (next_even() != 2 || next_even() != 4) abort();
+    *shared() += 1;
+    if (*shared() != 8) abort();
+    return 0;
+}
+
+// run
+// hoist_static_locals=true
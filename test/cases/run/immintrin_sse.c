@@ -0,0 +1,30 @@
+#include <stdlib.h>
+#include <immintrin.h>
+int main(void) {
+    __m128 a = _mm_set_ps(4.0f, 3.0f, 2.0f, 1.0f);
+    __m128 b = _mm_set1_ps(0.5f);
+    float f[4];
+    _mm_storeu_ps(f, _mm_add_ps(a, b));
+    if (f[0] != 1.5f || f[1] != 2.5f || f[2] != 3.5f || f[3] != 4.5f) abort();
+    _mm_storeu_ps(f, _mm_mul_ps(_mm_sub_ps(a, b), b));
+    if (f[0] != 0.25f || f[3] != 1.75f) abort();
+    _mm_storeu_ps(f, _mm_max_ps(a, _mm_set1_ps(2.5f)));
+    if (f[0] != 2.5f || f[1] != 2.5f || f[2] != 3.0f || f[3] != 4.0f) abort();
+    if (_mm_movemask_ps(_mm_cmplt_ps(a, _mm_set1_ps(2.5f))) != 0x3) abort();
+    if (_mm_cvtss_f32(_mm_sqrt_ss(_mm_set_ss(16.0f))) != 4.0f) abort();
+
+    __m128i x = _mm_setr_epi32(1, 2, 3, 4);
+    __m128i y = _mm_set1_epi32(10);
+    int i[4];
+    _mm_storeu_si128((__m128i *)i, _mm_add_epi32(x, y));
+    if (i[0] != 11 || i[1] != 12 || i[2] != 13 || i[3] != 14) abort();
+    _mm_storeu_si128((__m128i *)i, _mm_slli_epi32(x, 2));
+    if (i[0] != 4 || i[3] != 16) abort();
+    __m128i sat = _mm_adds_epi16(_mm_set1_epi16(32000), _mm_set1_epi16(1000));
+    if (_mm_extract_epi16(sat, 0) != 32767) abort();
+    if (_mm_movemask_epi8(_mm_cmpeq_epi8(x, x)) != 0xFFFF) abort();
+    return 0;
+}
+
+// run
+// target=x86_64-linux
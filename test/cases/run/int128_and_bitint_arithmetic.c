@@ -0,0 +1,32 @@
+#include <stdlib.h>
+#include <stdint.h>
+static uint64_t mulhi(uint64_t a, uint64_t b) {
+    return (uint64_t)(((unsigned __int128)a * b) >> 64);
+}
+int main(void) {
+    if (mulhi(UINT64_MAX, UINT64_MAX) != UINT64_MAX - 1) abort();
+    if (mulhi(1ull << 63, 4) != 2) abort();
+
+    __int128 big = (__int128)INT64_MIN * 3;
+    if ((long long)(big >> 64) != -2) abort();
+
+    _BitInt(37) narrow = -5;
+    long wide = narrow;
+    if (wide != -5) abort();
+    unsigned _BitInt(64) u = UINT64_MAX;
+    long long s = u;
+    if (s != -1) abort();
+    unsigned _BitInt(7) small = 100;
+    int promoted = small + 100;
+    if (promoted != 200) abort();
+
+    __bf16 h = 1.5f;
+    float f = h;
+    if (f != 1.5f) abort();
+    h = 3;
+    if ((int)h != 3) abort();
+    return 0;
+}
+
+// run
+// target=x86_64-linux
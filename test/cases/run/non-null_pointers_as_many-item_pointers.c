@@ -0,0 +1,15 @@
+#include <stdlib.h>
+static double dot(int n, const double x[static 1], const double y[static 1]) {
+    double sum = 0;
+    for (int i = 0; i < n; i++) sum += x[i] * y[i];
+    return sum;
+}
+int main(void) {
+    double a[4] = {1, 2, 3, 4};
+    double *p = a;
+    for (int i = 0; i < 4; i++) p[i] *= 2;
+    if (dot(4, a, a) != 120.0) abort();
+    return 0;
+}
+
+// run
@@ -0,0 +1,30 @@
+#include <stdlib.h>
+typedef double *restrict vec;
+static void axpy(int n, double a, const double *restrict x, vec y) {
+    for (int i = 0; i < n; i++) {
+        y[i] += a * x[i];
+    }
+}
+static double dot(int n, const double *restrict x, const double *restrict y) {
+    double sum = 0;
+    for (int i = 0; i < n; i++) {
+        sum += x[i] * y[i];
+    }
+    return sum;
+}
+int main(void) {
+    double x[8], y[8];
+    for (int i = 0; i < 8; i++) {
+        x[i] = i;
+        y[i] = 1;
+    }
+    void (*axpy_ptr)(int, double, const double *restrict, vec) = axpy;
+    axpy_ptr(8, 2.0, x, y);
+    for (int i = 0; i < 8; i++) {
+        if (y[i] != 1 + 2.0 * i) abort();
+    }
+    if (dot(8, x, x) != 140.0) abort();
+    return 0;
+}
+
+// run
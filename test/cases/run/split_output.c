@@ -0,0 +1,20 @@
+#include <stdlib.h>
+#include <string.h>
+struct entry {
+    const char *key;
+    int value;
+};
+static int compare_entries(const void *a, const void *b) {
+    return strcmp(((const struct entry *)a)->key, ((const struct entry *)b)->key);
+}
+int main(void) {
+    struct entry entries[] = { { "c", 3 }, { "a", 1 }, { "b", 2 } };
+    qsort(entries, 3, sizeof(struct entry), compare_entries);
+    for (int i = 0; i < 3; i++) {
+        if (entries[i].value != i + 1) abort();
+    }
+    return 0;
+}
+
+// run
+// split_output=true
@@ -0,0 +1,43 @@
+#include <stdlib.h>
+static const unsigned long hello_len = __builtin_strlen("hello");
+static const int hello_cmp = __builtin_strcmp("hello", "help");
+int main(void) {
+    if (hello_len != 5) abort();
+    if (hello_cmp >= 0) abort();
+
+    char buf[200];
+    for (int start = 0; start < 32; start++) {
+        for (int len = 0; len < 100; len++) {
+            __builtin_memset(buf, 'x', sizeof(buf));
+            __builtin_memset(buf + start, 'a', len);
+            buf[start + len] = 0;
+            if (__builtin_strlen(buf + start) != len) abort();
+            if (__builtin_memchr(buf + start, 0, len + 1) != buf + start + len) abort();
+            if (__builtin_memchr(buf + start, 'x', len) != 0) abort();
+        }
+    }
+
+    char a[100], b[100];
+    for (int i = 0; i < 99; i++) a[i] = b[i] = 'a' + i % 26;
+    a[99] = b[99] = 0;
+    if (__builtin_strcmp(a, b) != 0) abort();
+    if (__builtin_memcmp(a, b, 100) != 0) abort();
+    b[70] = 'A';
+    if (__builtin_strcmp(a, b) <= 0) abort();
+    if (__builtin_strcmp(b, a) >= 0) abort();
+    if (__builtin_memcmp(a, b, 70) != 0) abort();
+    if (__builtin_memcmp(a, b, 71) <= 0) abort();
+    b[70] = 0;
+    if (__builtin_strcmp(a, b) <= 0) abort();
+    a[5] = (char)200;
+    if (__builtin_memcmp(a, b, 6) <= 0) abort();
+
+    for (int i = 0; i < 10; i++) a[i] = '0' + i;
+    __builtin_memmove(a + 1, a, 5);
+    if (a[0] != '0' || a[1] != '0' || a[5] != '4' || a[6] != '6') abort();
+    __builtin_memmove(a, a + 1, 5);
+    if (a[0] != '0' || a[4] != '4' || a[5] != '4') abort();
+    return 0;
+}
+
+// run
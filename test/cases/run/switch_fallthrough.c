@@ -0,0 +1,33 @@
+#include <stdlib.h>
+static int count_down(int n) {
+    int res = 0;
+    switch (n) {
+        case 4: res += 4;
+        case 3: res += 3;
+        case 2 ... 2: res += 2;
+        default: res += 100;
+        case 1: res += 1;
+            break;
+        case 0:
+            return -1;
+    }
+    return res;
+}
+static int single_statement(int n) {
+    int res = 0;
+    switch (n) case 7: res = 7;
+    return res;
+}
+int main(void) {
+    if (count_down(4) != 110) abort();
+    if (count_down(3) != 106) abort();
+    if (count_down(2) != 103) abort();
+    if (count_down(1) != 1) abort();
+    if (count_down(0) != -1) abort();
+    if (count_down(9) != 101) abort();
+    if (single_statement(7) != 7) abort();
+    if (single_statement(6) != 0) abort();
+    return 0;
+}
+
+// run
@@ -0,0 +1,48 @@
+#include <stdlib.h>
+#include <stdint.h>
+typedef int32_t __v4si __attribute__((__vector_size__(16)));
+typedef uint32_t __v4su __attribute__((__vector_size__(16)));
+typedef float __v4sf __attribute__((__vector_size__(16)));
+int main(void) {
+    __v4si a = {-7, 7, -8, 9};
+    __v4si b = {2, -2, 3, 3};
+
+    __v4si quot = a / b;
+    __v4si rem = a % b;
+    for (int i = 0; i < 4; i++) {
+        if (quot[i] != a[i] / b[i]) abort();
+        if (rem[i] != a[i] % b[i]) abort();
+    }
+
+    __v4si lt = a < b;
+    __v4si eq = a == (__v4si){-7, 0, -8, 0};
+    for (int i = 0; i < 4; i++) {
+        if (lt[i] != (a[i] < b[i] ? -1 : 0)) abort();
+    }
+    if (eq[0] != -1 || eq[1] != 0 || eq[2] != -1 || eq[3] != 0) abort();
+
+    int scale = 3;
+    __v4si scaled = a * scale + 1;
+    for (int i = 0; i < 4; i++) {
+        if (scaled[i] != a[i] * 3 + 1) abort();
+    }
+
+    __v4su u = {0, 1, 2, 3};
+    u = u - 1u;
+    if (u[0] != UINT32_MAX || u[3] != 2) abort();
+
+    __v4sf f = {1.0f, 2.0f, 3.0f, 4.0f};
+    f = f * 0.5f;
+    __v4si fcmp = f > 1.0f;
+    if (f[3] != 2.0f) abort();
+    if (fcmp[0] != 0 || fcmp[1] != 0 || fcmp[2] != -1 || fcmp[3] != -1) abort();
+
+    for (int i = 0; i < 4; i++) {
+        a[i] = i * 10;
+    }
+    a[1] += 5;
+    if (a[0] != 0 || a[1] != 15 || a[2] != 20 || a[3] != 30) abort();
+    return 0;
+}
+
+// run
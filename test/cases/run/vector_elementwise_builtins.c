@@ -0,0 +1,23 @@
+#include <stdlib.h>
+typedef int __v4si __attribute__((__vector_size__(16)));
+int main(void) {
+    __v4si a = {-5, 3, -2147483647 - 1, 7};
+    __v4si b = {4, 4, 4, 4};
+
+    __v4si abs = __builtin_elementwise_abs(a);
+    if (abs[0] != 5 || abs[1] != 3 || abs[2] != -2147483647 - 1) abort();
+
+    __v4si max = __builtin_elementwise_max(a, b);
+    __v4si min = __builtin_elementwise_min(a, b);
+    if (max[0] != 4 || max[3] != 7 || min[0] != -5 || min[3] != 4) abort();
+
+    __v4si sat = __builtin_elementwise_sub_sat(a, b);
+    if (sat[2] != -2147483647 - 1 || sat[3] != 3) abort();
+
+    if (__builtin_reduce_add(b) != 16) abort();
+    if (__builtin_reduce_max(a) != 7) abort();
+    if (__builtin_reduce_min(a) != -2147483647 - 1) abort();
+    return 0;
+}
+
+// run
@@ -0,0 +1,37 @@
+#include <stdlib.h>
+typedef float __v4sf __attribute__((__vector_size__(16)));
+typedef int __v4si __attribute__((__vector_size__(16)));
+typedef short __v8hi __attribute__((__vector_size__(16)));
+typedef char __v16qi __attribute__((__vector_size__(16)));
+typedef long long __v2di __attribute__((__vector_size__(16)));
+int main(void) {
+    __v4sf a = {1.0f, -2.0f, 3.0f, -4.0f};
+    __v4sf b = {2.0f, -3.0f, 3.0f, 0.0f};
+
+    __v4sf max = __builtin_ia32_maxps(a, b);
+    __v4sf min = __builtin_ia32_minps(a, b);
+    if (max[0] != 2.0f || max[1] != -2.0f || max[3] != 0.0f) abort();
+    if (min[0] != 1.0f || min[1] != -3.0f || min[3] != -4.0f) abort();
+    if (__builtin_ia32_movmskps(a) != 0xA) abort();
+
+    __v4si lt = (__v4si)__builtin_ia32_cmpltps(a, b);
+    if (lt[0] != -1 || lt[1] != 0 || lt[2] != 0 || lt[3] != -1) abort();
+
+    __v4si shifted = __builtin_ia32_pslldi128((__v4si){1, 2, 3, 4}, 4);
+    if (shifted[0] != 16 || shifted[3] != 64) abort();
+    __v4si arith = __builtin_ia32_psradi128((__v4si){-16, 16, -1, 1}, 40);
+    if (arith[0] != -1 || arith[1] != 0 || arith[2] != -1 || arith[3] != 0) abort();
+
+    __v4si madd = __builtin_ia32_pmaddwd128((__v8hi){1, 2, 3, 4, 5, 6, 7, 8}, (__v8hi){1, 1, 2, 2, 3, 3, 4, 4});
+    if (madd[0] != 3 || madd[1] != 14 || madd[2] != 33 || madd[3] != 60) abort();
+
+    __v2di sad = __builtin_ia32_psadbw128((__v16qi){1, 2, 3, 4, 5, 6, 7, 8}, (__v16qi){8, 7, 6, 5, 4, 3, 2, 1});
+    if (sad[0] != 32 || sad[1] != 0) abort();
+
+    __v16qi packed = __builtin_ia32_packsswb128((__v8hi){300, -300, 5, 0, 0, 0, 0, 0}, (__v8hi){0});
+    if (packed[0] != 127 || packed[1] != (char)-128 || packed[2] != 5) abort();
+    return 0;
+}
+
+// run
+// target=x86_64-linux
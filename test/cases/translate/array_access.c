@@ -10,7 +10,7 @@ int foo(int index) {
 // pub export fn foo(arg_index: c_int) c_int {
 //     var index = arg_index;
 //     _ = &index;
-//     return array[@bitCast(@as(isize, @intCast(index)))];
+//     return array[__helpers.signedOffset(index)];
 // }
 //
 // pub inline fn ACCESS() @TypeOf(array[@as(usize, @intCast(@as(c_int, 2)))]) {
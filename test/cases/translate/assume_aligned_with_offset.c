@@ -0,0 +1,10 @@
+void *aligned_offset(void *p) {
+    return __builtin_assume_aligned(p, 16, 4);
+}
+
+// translate
+//
+// :2:12: warning: TODO __builtin_assume_aligned with an offset
+//
+// :1:7: warning: unable to translate function, demoted to extern
+// pub extern fn aligned_offset(arg_p: ?*anyopaque) ?*anyopaque;
@@ -0,0 +1,42 @@
+__bf16 to_bf16(float f) {
+    return f;
+}
+double from_bf16(__bf16 h) {
+    return h;
+}
+int bf16_to_int(__bf16 h) {
+    return h;
+}
+__bf16 ext_bf16(__bf16 h);
+unsigned long long widen(unsigned _BitInt(64) x) {
+    long long y = x;
+    return y;
+}
+#define WIDE_BITINT 0x1ffwb
+#define UNSIGNED_BITINT 5uwb
+#define LONG_DOUBLE_CAST ((long double)1)
+
+// translate
+// target=x86_64-linux
+//
+// pub fn to_bf16(arg_f: f32) callconv(.c) __helpers.BFloat16 {
+//     var f = arg_f;
+//     _ = &f;
+//     return __helpers.floatToBf16(f);
+// }
+//
+// pub fn from_bf16(arg_h: __helpers.BFloat16) callconv(.c) f64 {
+//     var h = arg_h;
+//     _ = &h;
+//     return __helpers.bf16ToFloat(f64, h);
+// }
+//
+//     return @intFromFloat(__helpers.bf16ToFloat(f32, h));
+//
+// pub const ext_bf16 = @compileError("unable to translate extern function with __bf16 in its signature");
+//
+//     var y: c_longlong = @bitCast(x);
+//
+// pub const WIDE_BITINT = @as(i10, 0x1ff);
+// pub const UNSIGNED_BITINT = @as(u3, 5);
+// pub const LONG_DOUBLE_CAST = __helpers.cast(c_longdouble, @as(c_int, 1));
@@ -0,0 +1,18 @@
+void bf16_ops(__bf16 *p, float f) {
+    __bf16 h = *p;
+    h = -h;
+    h += f;
+    h *= h;
+    h++;
+    --h;
+    *p = h;
+}
+
+// translate
+// target=x86_64-linux
+//
+//     h = __helpers.floatToBf16(-__helpers.bf16ToFloat(f32, h));
+//
+//         ref.* = __helpers.floatToBf16(__helpers.bf16ToFloat(f32, ref.*) + 1);
+//
+//         ref.* = __helpers.floatToBf16(__helpers.bf16ToFloat(f32, ref.*) - 1);
@@ -0,0 +1,35 @@
+void bar(void);
+int foo(int x) {
+    if (__builtin_expect(x, 0)) return 1;
+    if (__builtin_expect(x > 2, 1)) {
+        bar();
+    }
+    return __builtin_expect(x < 0, 0) ? 2 : 3;
+}
+__attribute__((cold)) void baz(void) {
+    bar();
+}
+
+// translate
+//
+// pub export fn foo(arg_x: c_int) c_int {
+//     var x = arg_x;
+//     _ = &x;
+//     if (x != 0) {
+//         @branchHint(.unlikely);
+//         return 1;
+//     }
+//     if (x > @as(c_int, 2)) {
+//         @branchHint(.likely);
+//         bar();
+//     }
+//     return if (x < @as(c_int, 0)) blk: {
+//         @branchHint(.unlikely);
+//         break :blk @as(c_int, 2);
+//     } else @as(c_int, 3);
+// }
+//
+// pub export fn baz() void {
+//     @branchHint(.cold);
+//     bar();
+// }
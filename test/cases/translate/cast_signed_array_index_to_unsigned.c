@@ -10,5 +10,5 @@ void foo() {
 //     _ = &a;
 //     var i: c_int = 0;
 //     _ = &i;
-//     a[@bitCast(@as(isize, @intCast(i)))] = 0;
+//     a[__helpers.signedOffset(i)] = 0;
 // }
@@ -74,7 +74,7 @@ void foo(void) {
 //         const ref = &a;
 //         ref.* = __helpers.signedRemainder(ref.*, blk: {
 //             const ref_1 = &a;
-//             ref_1.* = __helpers.signedRemainder(ref_1.*, @as(c_int, 1));
+//             ref_1.* = @rem(ref_1.*, @as(c_int, 1));
 //             break :blk ref_1.*;
 //         });
 //     }
@@ -31,10 +31,10 @@ int entry(int i) {
 //     _ = &res;
 //     while (true) {
 //         while (true) {
-//             switch (res) {
+//             sw: switch (res) {
 //                 @as(c_int, 0) => {
 //                     res += 1;
-//                     continue;
+//                     continue :sw @as(c_int, 1);
 //                 },
 //                 @as(c_int, 1) => {
 //                     continue;
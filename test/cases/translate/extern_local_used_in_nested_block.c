@@ -18,7 +18,7 @@ int foo(int bar) {
 //     };
 //     _ = &extern_local_arr;
 //     if (bar != 0) {
-//         return (extern_local_arr.arr + @as(usize, @bitCast(@as(isize, @intCast(@as(c_int, 2)))))).*;
+//         return (extern_local_arr.arr + @as(usize, @intCast(@as(c_int, 2)))).*;
 //     }
 //     return 0;
 // }
\ No newline at end of file
@@ -0,0 +1,26 @@
+unsigned long unknown(char *p) {
+    unsigned long max = __builtin_object_size(p, 0);
+    unsigned long min = __builtin_object_size(p, 2);
+    return max - min;
+}
+unsigned long known(void) {
+    char buf[16];
+    struct { char name[8]; int x; } s;
+    unsigned long whole = __builtin_object_size(buf, 0);
+    unsigned long member = __builtin_object_size(s.name, 1);
+    unsigned long literal = __builtin_object_size("abc", 0);
+    return whole + member + literal;
+}
+
+// translate
+// target=x86_64-linux
+//
+//     var max: c_ulong = @as(usize, 18446744073709551615);
+//     _ = &max;
+//     var min: c_ulong = @as(usize, 0);
+//
+//     var whole: c_ulong = @as(usize, 16);
+//
+//     var member: c_ulong = @as(usize, 8);
+//
+//     var literal: c_ulong = @as(usize, 4);
@@ -0,0 +1,24 @@
+struct point { int x, y; };
+int counter(void) {
+    static int calls;
+    _Thread_local static int bar = 2;
+    static int *last = &calls;
+    struct local { int v; };
+    static struct local kept;
+    calls += 1;
+    return calls + bar + *last + kept.v;
+}
+
+// translate
+// hoist_static_locals=true
+//
+// var static_local_calls: c_int = 0;
+// threadlocal var static_local_bar: c_int = 2;
+// var static_local_last: [*c]c_int = &static_local_calls;
+// pub export fn counter() c_int {
+//
+//     const static_local_kept = struct {
+//         var kept: struct_local = @import("std").mem.zeroes(struct_local);
+//     };
+//
+//     static_local_calls += 1;
@@ -0,0 +1,42 @@
+static inline int twice(int x) {
+    return x * 2;
+}
+static inline int addressed(int x) {
+    return x + 1;
+}
+static inline int countdown(int x) {
+    return x ? countdown(x - 1) : 0;
+}
+static inline int pong(int x);
+static inline int ping(int x) {
+    return x ? pong(x - 1) : 0;
+}
+static inline int pong(int x) {
+    return x ? ping(x - 1) : 1;
+}
+__attribute__((noinline)) int opaque_add(int a, int b) {
+    return a + b;
+}
+int use(void) {
+    int (*fp)(int) = addressed;
+    int a = twice(3);
+    int b = opaque_add(1, 2);
+    return a + b + fp(1) + countdown(2) + ping(3);
+}
+
+// translate
+// inline_static_fns=true
+//
+// pub inline fn twice(arg_x: c_int) c_int {
+//
+// pub fn addressed(arg_x: c_int) callconv(.c) c_int {
+//
+// pub fn countdown(arg_x: c_int) callconv(.c) c_int {
+//
+// pub fn ping(arg_x: c_int) callconv(.c) c_int {
+//
+// pub fn pong(arg_x: c_int) callconv(.c) c_int {
+//
+//     var a: c_int = twice(@as(c_int, 3));
+//
+//     var b: c_int = @call(.never_inline, opaque_add, .{ @as(c_int, 1), @as(c_int, 2) });
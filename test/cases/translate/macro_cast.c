@@ -14,4 +14,4 @@ int baz(void *arg) { return 0; }
 //
 // pub const BAR = __helpers.cast(?*anyopaque, a);
 //
-// pub const BAZ = __helpers.cast(u32, @as(c_int, 2));
+// pub const BAZ = @as(u32, 2);
@@ -3,6 +3,6 @@
 
 // translate
 //
-// pub const NULL = __helpers.cast(?*anyopaque, @as(c_int, 0));
+// pub const NULL = @as(?*anyopaque, null);
 //
 // pub const FOO = __helpers.cast(c_int, __helpers.promoteIntLiteral(c_int, 0x8000, .hex));
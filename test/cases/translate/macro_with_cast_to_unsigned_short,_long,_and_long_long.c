@@ -4,6 +4,6 @@
 
 // translate
 //
-// pub const CURLAUTH_BASIC_BUT_USHORT = __helpers.cast(c_ushort, @as(c_int, 1));
-// pub const CURLAUTH_BASIC = __helpers.cast(c_ulong, @as(c_int, 1));
-// pub const CURLAUTH_BASIC_BUT_ULONGLONG = __helpers.cast(c_ulonglong, @as(c_int, 1));
+// pub const CURLAUTH_BASIC_BUT_USHORT = @as(c_ushort, 1);
+// pub const CURLAUTH_BASIC = @as(c_ulong, 1);
+// pub const CURLAUTH_BASIC_BUT_ULONGLONG = @as(c_ulonglong, 1);
@@ -0,0 +1,21 @@
+typedef signed char v16i8 __attribute__((vector_size(16)));
+typedef int v4i32 __attribute__((vector_size(16)));
+
+/* Calls the builtins the way arm_neon.h does for vld1q_s32, vqaddq_s32,
+   vst1q_s32 and vaddvq_s32. */
+int add_rows(const int *a, const int *b, int *out) {
+    v16i8 x = __builtin_neon_vld1q_v(a, 34);
+    v16i8 y = __builtin_neon_vld1q_v(b, 34);
+    v16i8 sum = __builtin_neon_vqaddq_v(x, y, 34);
+    __builtin_neon_vst1q_v(out, sum, 34);
+    return __builtin_neon_vaddvq_s32((v4i32)sum);
+}
+
+// translate
+// target=aarch64-linux
+//
+// pub export fn add_rows(arg_a: [*c]const c_int, arg_b: [*c]const c_int, arg_out: [*c]c_int) c_int {
+// __builtin.neon_vld1q_v(
+// __builtin.neon_vqaddq_v(x, y,
+// __builtin.neon_vst1q_v(
+// return __builtin.neon_vaddvq_s32(
@@ -0,0 +1,32 @@
+float sum(int n, const float values[static 4]) {
+    float res = 0;
+    for (int i = 0; i < n; i++) res += values[i];
+    return res;
+}
+int first(int maybe_null[static 1]) {
+    if (!maybe_null) return 0;
+    return maybe_null[0];
+}
+int head(int values[static 2]) {
+    return values[0];
+}
+int (*head_ptr)(int *) = head;
+int local(void) {
+    int arr[4] = {1, 2, 3, 4};
+    int *p = arr;
+    int *q = arr;
+    q += 1;
+    return p[1] + *q;
+}
+
+// translate
+//
+// pub export fn sum(arg_n: c_int, arg_values: [*]const f32) f32 {
+//
+// pub export fn first(arg_maybe_null: [*c]c_int) c_int {
+//
+// pub export fn head(arg_values: [*c]c_int) c_int {
+//
+//     var p: [*]c_int = @ptrCast(@alignCast(&arr));
+//     _ = &p;
+//     var q: [*c]c_int = @ptrCast(@alignCast(&arr));
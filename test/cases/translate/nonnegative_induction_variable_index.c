@@ -0,0 +1,43 @@
+void fill(int *values, int n) {
+    for (int i = 0; i < n; i++) {
+        values[i] = i;
+    }
+}
+int count(const int *values) {
+    int i = 0;
+    while (i < 8) {
+        if (*(values + i) == 0) break;
+        i++;
+    }
+    return i;
+}
+void clear(int *values) {
+    for (int i = 9; i >= 0; i--) {
+        values[i] = 0;
+    }
+}
+
+// translate
+//
+// pub export fn fill(arg_values: [*c]c_int, arg_n: c_int) void {
+//     var values = arg_values;
+//     _ = &values;
+//     var n = arg_n;
+//     _ = &n;
+//     {
+//         var i: c_int = 0;
+//         _ = &i;
+//         while (i < n) : (i += 1) {
+//             values[@intCast(i)] = i;
+//         }
+//     }
+// }
+//
+//     while (i < @as(c_int, 8)) {
+//         if ((values + @as(usize, @intCast(i))).* == @as(c_int, 0)) break;
+//         i += 1;
+//     }
+//
+//         while (i >= @as(c_int, 0)) : (i -= 1) {
+//             values[__helpers.signedOffset(i)] = 0;
+//         }
@@ -0,0 +1,9 @@
+typedef float *restrict float_ptr;
+void scale(float_ptr dst, const float *restrict src, int n);
+typedef void (*kernel)(float *restrict, const float *restrict);
+
+// translate
+//
+// pub extern fn scale(noalias dst: float_ptr, noalias src: [*c]const f32, n: c_int) void;
+//
+// pub const kernel = ?*const fn (noalias [*c]f32, noalias [*c]const f32) callconv(.c) void;
@@ -9,7 +9,7 @@ void foo(void) {
 
 // translate
 //
-// pub export var a: [*c]c_int = @ptrCast(@alignCast((&a) + @as(usize, @bitCast(@as(isize, @intCast(@as(c_int, 1)))))));
+// pub export var a: [*c]c_int = @ptrCast(@alignCast((&a) + @as(usize, @intCast(@as(c_int, 1)))));
 // pub extern fn alloc(c_ulonglong) ?*anyopaque;
 // pub export fn foo() void {
 //     var b: c_int = undefined;
@@ -0,0 +1,21 @@
+int digit(int x) {
+    return x % 10;
+}
+int wrap(int x, int n) {
+    return x % n;
+}
+
+// translate
+//
+// pub export fn digit(arg_x: c_int) c_int {
+//     var x = arg_x;
+//     _ = &x;
+//     return @rem(x, @as(c_int, 10));
+// }
+// pub export fn wrap(arg_x: c_int, arg_n: c_int) c_int {
+//     var x = arg_x;
+//     _ = &x;
+//     var n = arg_n;
+//     _ = &n;
+//     return __helpers.signedRemainder(x, n);
+// }
@@ -0,0 +1,27 @@
+#define TRUNCATED ((unsigned char)300)
+#define NEGATIVE_UNSIGNED ((unsigned)-1)
+#define SIGNED_SHORT ((short)0x7fff)
+#define NULL_CHAR_PTR ((char *)0)
+#define ADDRESS ((unsigned char *)4096)
+#define MAX_ADDRESS ((void *)0xffffffffffffffffULL)
+#define INT_SIZE sizeof(int)
+#define PTR_SIZE sizeof(void *)
+#define VOID_SIZE sizeof(void)
+#define CAST_PARAM(x) ((unsigned)(x))
+
+// translate
+// target=x86_64-linux
+//
+// pub const TRUNCATED = @as(u8, 44);
+// pub const NEGATIVE_UNSIGNED = @as(c_uint, 4294967295);
+// pub const SIGNED_SHORT = @as(c_short, 32767);
+// pub const NULL_CHAR_PTR = @as([*c]u8, null);
+// pub const ADDRESS = @as([*c]u8, @ptrFromInt(4096));
+// pub const MAX_ADDRESS = @as(?*anyopaque, @ptrFromInt(18446744073709551615));
+// pub const INT_SIZE = @as(usize, @sizeOf(c_int));
+// pub const PTR_SIZE = @as(usize, @sizeOf(?*anyopaque));
+// pub const VOID_SIZE = __helpers.sizeof(anyopaque);
+// pub inline fn CAST_PARAM(x: anytype) c_uint {
+//     _ = &x;
+//     return __helpers.cast(c_uint, x);
+// }
@@ -0,0 +1,41 @@
+void bar(int);
+void foo(int x) {
+    switch (x) {
+        case 0: bar(0);
+        case 1: bar(1);
+        default: bar(2);
+    }
+    switch (x) case 3: bar(3);
+}
+
+// translate
+//
+// pub export fn foo(arg_x: c_int) void {
+//     var x = arg_x;
+//     _ = &x;
+//     while (true) {
+//         sw: switch (x) {
+//             @as(c_int, 0) => {
+//                 bar(0);
+//                 continue :sw @as(c_int, 1);
+//             },
+//             @as(c_int, 1) => {
+//                 bar(1);
+//                 bar(2);
+//             },
+//             else => {
+//                 bar(2);
+//             },
+//         }
+//         break;
+//     }
+//     while (true) {
+//         switch (x) {
+//             @as(c_int, 3) => {
+//                 bar(3);
+//             },
+//             else => {},
+//         }
+//         break;
+//     }
+// }
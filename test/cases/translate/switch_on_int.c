@@ -37,12 +37,10 @@ void switch_fn(int i) {
 //     var res: c_int = 0;
 //     _ = &res;
 //     while (true) {
-//         switch (i) {
+//         sw: switch (i) {
 //             @as(c_int, 0) => {
 //                 res = 1;
-//                 res = 2;
-//                 res = @as(c_int, 3) * i;
-//                 break;
+//                 continue :sw @as(c_int, 1);
 //             },
 //             @as(c_int, 1)...@as(c_int, 3) => {
 //                 res = 2;
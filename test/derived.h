@@ -0,0 +1,22 @@
+#include "base.h"
+
+#undef BASE_VERSION
+#define BASE_VERSION 4
+
+typedef struct {
+    Point min, max;
+} Rect;
+
+static inline int rect_area(Rect r) {
+    return (r.max.x - r.min.x) * (r.max.y - r.min.y);
+}
+
+static inline int rect_color(void) {
+    return BASE_GREEN;
+}
+
+static inline int list_sum(struct base_list *list) {
+    int sum = 0;
+    for (; list; list = list->next) sum += list->value;
+    return sum;
+}
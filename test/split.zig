@@ -0,0 +1,9 @@
+const std = @import("std");
+const expectEqual = std.testing.expectEqual;
+
+const split = @import("split.h");
+
+test "a header uses a non-public declaration of another header" {
+    var point: @typeInfo(split.point_ref).pointer.child = .{ .x = 1, .y = 2 };
+    try expectEqual(@as(c_int, 3), split.point_sum(&point));
+}
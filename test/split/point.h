@@ -0,0 +1,3 @@
+typedef struct {
+    int x, y;
+} *point_ref;
@@ -0,0 +1 @@
+#include "sum.h"
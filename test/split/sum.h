@@ -0,0 +1,6 @@
+#include "point.h"
+
+static inline int point_sum(point_ref p) {
+    __typeof__(*p) copy = *p;
+    return copy.x + copy.y;
+}
@@ -0,0 +1,12 @@
+struct flags {
+    unsigned ready : 1;
+    unsigned error : 1;
+};
+
+int uses_goto(int x) {
+again:
+    if (x-- > 0) goto again;
+    return x;
+}
+
+#define UNBALANCED (1 +